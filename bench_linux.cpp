@@ -0,0 +1,535 @@
+/*
+
+	throughput of every encode/decode/validate/transcode path on generated text, the per-codepoint
+	functions are measured the same way as the baseline
+
+	g++ -std=c++14 -O2 -pthread bench_linux.cpp -o bench
+	./bench [--csv | --json] [scalar|sse4.2|avx2|avx512bw | --impls]
+
+	--impls runs the bulk functions with every implementation the CPU has, taking turns, and puts
+	them side by side, the one picked on its own is marked
+
+	GB/s are of input, cycles come from perf events when the kernel allows it and from the time
+	stamp counter otherwise (the "cycles" field says which)
+
+*/
+
+#define UTF_IMPLEMENTATION
+#include "utf.hpp"
+
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <string>
+#include <vector>
+#include <random>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+struct Corpus {
+	const char *name;
+	std::vector<uint8_t> u8, u16le, u16be, u32le, u32be;
+	// only when every codepoint is in Latin-1
+	std::vector<uint8_t> latin1;
+};
+
+void put(std::vector<uint8_t> &v, UTF_Point p) {
+	v.insert(v.end(), p.bytes, p.bytes + p.num_bytes);
+}
+
+// deterministic text, codepoints are drawn from the given ranges and errors_permille of them
+// are replaced with a word that can't be decoded
+Corpus make_corpus(const char *name, std::vector<std::pair<char32_t, char32_t>> ranges, size_t num_points, int errors_permille = 0) {
+	std::mt19937 rng(42);
+	Corpus c;
+	c.name = name;
+	for(size_t i = 0; i < num_points; i++) {
+		if(static_cast<int>(rng() % 1000) < errors_permille) {
+			// a stray continuation byte, a lone low surrogate, past U+10FFFF
+			c.u8.push_back(static_cast<uint8_t>(0x80 | rng() % 0x40));
+			char32_t low = 0xDC00 + rng() % 0x400;
+			put(c.u16le, utf16LE_encode(low));
+			put(c.u16be, utf16BE_encode(low));
+			char32_t big = 0x110000 + rng() % 0x1000;
+			put(c.u32le, utf32LE_encode(big));
+			put(c.u32be, utf32BE_encode(big));
+			continue;
+		}
+
+		auto &r = ranges[rng() % ranges.size()];
+		char32_t cp = r.first + rng() % (r.second - r.first + 1);
+		if(!utf_is_valid_cp(cp)) cp = ' ';
+		put(c.u8, utf8_encode(cp));
+		put(c.u16le, utf16LE_encode(cp));
+		put(c.u16be, utf16BE_encode(cp));
+		put(c.u32le, utf32LE_encode(cp));
+		put(c.u32be, utf32BE_encode(cp));
+		if(cp <= 0xFF) c.latin1.push_back(static_cast<uint8_t>(cp));
+	}
+	if(c.latin1.size() * 4 != c.u32le.size()) c.latin1.clear();
+	return c;
+}
+
+
+double now() {
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// core cycles from perf events, the time stamp counter where they aren't available (VMs, paranoid kernels)
+struct Cycles {
+	int fd = -1;
+	const char *source = "none";
+
+	Cycles() {
+		perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.size = sizeof(attr);
+		attr.config = PERF_COUNT_HW_CPU_CYCLES;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+		if(fd >= 0) source = "cpu";
+#if defined(__x86_64__) || defined(__i386__)
+		else source = "tsc";
+#endif
+	}
+
+	uint64_t get() const {
+		uint64_t v = 0;
+		if(fd >= 0 && read(fd, &v, sizeof(v)) == sizeof(v)) return v;
+#if defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+#else
+		return 0;
+#endif
+	}
+};
+
+Cycles cycles;
+
+struct Speed {
+	double gbps = 0, cycles_per_byte = 0;
+};
+
+// fastest of a few runs
+template<class Fn>
+Speed measure(size_t bytes, Fn fn) {
+	volatile size_t sink;
+	Speed best;
+	for(int i = 0; i < 5; i++) {
+		double t = now();
+		uint64_t c = cycles.get();
+		sink = fn();
+		c = cycles.get() - c;
+		t = now() - t;
+		if(bytes / t / 1e9 > best.gbps) {
+			best.gbps = bytes / t / 1e9;
+			best.cycles_per_byte = static_cast<double>(c) / bytes;
+		}
+	}
+	(void)sink;
+	return best;
+}
+
+
+// the bulk functions stop at the first error, these go on after it like a caller skipping bad words does
+typedef UTF_Bulk (*Bulk)(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en);
+
+size_t run_bulk(Bulk fn, const std::vector<uint8_t> &src, UTF_TYPE from, UTF_TYPE to, UTF_BOM en, std::vector<uint8_t> &out) {
+	size_t ws_from = utf::word_size(from), ws_to = utf::word_size(to);
+	size_t len = src.size() / ws_from, cap = out.size() / ws_to, i = 0, o = 0;
+	while(i < len) {
+		UTF_Bulk b = fn(src.data() + i * ws_from, len - i, out.data() + o * ws_to, cap - o, en);
+		i += b.num_read + (b.result != UTF_OK);
+		o += b.num_written;
+	}
+	return o;
+}
+
+UTF_Bulk utf16_swap_valid(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en) { return utf16_swap(src, len, dst, cap, en, true); }
+UTF_Bulk utf32_swap_valid(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en) { return utf32_swap(src, len, dst, cap, en, true); }
+UTF_Bulk latin1_to_utf8_bulk(const void *src, size_t len, void *dst, size_t cap, UTF_BOM) { return latin1_to_utf8(src, len, dst, cap); }
+UTF_Bulk utf8_to_latin1_bulk(const void *src, size_t len, void *dst, size_t cap, UTF_BOM) { return utf8_to_latin1(src, len, dst, cap); }
+
+size_t run_transcode(const std::vector<uint8_t> &src, UTF_TYPE from, UTF_BOM from_bom, UTF_TYPE to, UTF_BOM to_bom, std::vector<uint8_t> &out, unsigned num_threads) {
+	size_t ws_from = utf::word_size(from), ws_to = utf::word_size(to);
+	size_t len = src.size() / ws_from, cap = out.size() / ws_to, i = 0, o = 0;
+	while(i < len) {
+		UTF_Bulk b = num_threads == 1
+			? utf_transcode(src.data() + i * ws_from, len - i, from, from_bom, out.data() + o * ws_to, cap - o, to, to_bom)
+			: utf_transcode_parallel(src.data() + i * ws_from, len - i, from, from_bom, out.data() + o * ws_to, cap - o, to, to_bom, num_threads);
+		i += b.num_read + (b.result != UTF_OK);
+		o += b.num_written;
+	}
+	return o;
+}
+
+size_t run_validate(const std::vector<uint8_t> &src) {
+	size_t i = 0, errors = 0;
+	while(i < src.size()) {
+		UTF_Bulk b = utf8_validate(src.data() + i, src.size() - i);
+		i += b.num_read + (b.result != UTF_OK);
+		errors += b.result != UTF_OK;
+	}
+	return errors;
+}
+
+// UTF-8 to UTF-16LE in 64 KiB pieces, a new stream after an error
+size_t run_stream(const std::vector<uint8_t> &src, std::vector<uint8_t> &out) {
+	UTF_Stream st = utf_stream(UTF8, UTF_LE, UTF16, UTF_LE);
+	size_t o = 0;
+	for(size_t pos = 0; pos < src.size();) {
+		size_t len = src.size() - pos < (1 << 16) ? src.size() - pos : (1 << 16);
+		UTF_Bulk b = utf_stream_write(&st, src.data() + pos, len, out.data() + o * 2, out.size() / 2 - o);
+		o += b.num_written;
+		pos += b.num_read;
+		if(b.result != UTF_OK && b.result != UTF_OUTPUT_FULL) {
+			st = utf_stream(UTF8, UTF_LE, UTF16, UTF_LE);
+			pos++;
+		}
+	}
+	return o;
+}
+
+// out through a fixed-size buffer that is flushed (here: dropped) after every call
+size_t run_drain(const std::vector<uint8_t> &src, UTF_TYPE from, UTF_TYPE to, size_t buf_bytes, std::vector<uint8_t> &out) {
+	size_t ws_from = utf::word_size(from), ws_to = utf::word_size(to);
+	size_t len = src.size() / ws_from, i = 0, o = 0;
+	while(i < len) {
+		UTF_Bulk b = utf_transcode(src.data() + i * ws_from, len - i, from, UTF_LE, out.data(), buf_bytes / ws_to, to, UTF_LE);
+		i += b.num_read + (b.result != UTF_OK && b.result != UTF_OUTPUT_FULL);
+		o += b.num_written;
+	}
+	return o;
+}
+
+// the whole text indexed in one go, entries every 256 codepoints
+size_t run_index(const std::vector<uint8_t> &src, std::vector<UTF_IndexEntry> &entries) {
+	UTF_Index ix = utf_index(entries.data(), entries.size(), 256);
+	utf_index_update(&ix, src.data(), src.size());
+	return ix.num_entries;
+}
+
+// a request every UTF_DETECT_SAMPLE bytes of the text (from where a codepoint starts) and all of the
+// text after it, only the sample of it is read
+size_t run_detect(const std::vector<uint8_t> &src, UTF_TYPE type) {
+	size_t n = 0;
+	for(size_t i = 0; i < src.size(); i += UTF_DETECT_SAMPLE) {
+		size_t beg = i;
+		while(type == UTF8 && beg < src.size() && (src[beg] & 0xC0) == 0x80) beg++;
+		n += utf_detect(src.data() + beg, src.size() - beg).confidence;
+	}
+	return n;
+}
+
+// what you had to write before the bulk functions
+size_t loop_transcode(const std::vector<uint8_t> &src, UTF_TYPE from, UTF_TYPE to, UTF_BOM en, std::vector<uint8_t> &out) {
+	size_t i = 0, o = 0;
+	while(i < src.size()) {
+		UTF_Point p = utf_decode(src.data() + i, from, en);
+		i += p.num_bytes;
+		if(p.result != UTF_OK) continue;
+		UTF_Point e = utf_encode(p.codepoint, to, en);
+		memcpy(out.data() + o, e.bytes, e.num_bytes);
+		o += e.num_bytes;
+	}
+	return o;
+}
+
+template<class Decode>
+size_t loop_decode(const std::vector<uint8_t> &src, Decode decode) {
+	size_t i = 0, sum = 0;
+	while(i < src.size()) {
+		auto p = decode(src.data() + i);
+		if(p.result == UTF_OK) sum += p.codepoint;
+		i += p.num_bytes;
+	}
+	return sum;
+}
+
+// the same codepoints from the end, like a cursor moving left
+template<class DecodePrev>
+size_t loop_decode_prev(const std::vector<uint8_t> &src, size_t word, DecodePrev decode_prev) {
+	size_t pos = src.size() / word, sum = 0;
+	while(pos > 0) {
+		UTF_Point p = decode_prev(src.data(), pos);
+		if(p.result == UTF_OK) sum += p.codepoint;
+		pos -= p.num_words;
+	}
+	return sum;
+}
+
+size_t loop_encode(const std::vector<char32_t> &cps, UTF_TYPE to, std::vector<uint8_t> &out) {
+	size_t o = 0;
+	for(char32_t cp : cps) {
+		UTF_Point e = utf_encode(cp, to, UTF_LE);
+		memcpy(out.data() + o, e.bytes, e.num_bytes);
+		o += e.num_bytes;
+	}
+	return o;
+}
+
+// the first of the two passes it took to size the output
+size_t loop_length(const std::vector<uint8_t> &src, UTF_TYPE from, UTF_TYPE to) {
+	size_t i = 0, n = 0;
+	while(i < src.size()) {
+		UTF_Point p = utf_decode(src.data() + i, from, UTF_LE);
+		i += p.num_bytes;
+		if(p.result == UTF_OK) n += utf_encode(p.codepoint, to, UTF_LE).num_words;
+	}
+	return n;
+}
+
+
+enum Format { TABLE, CSV, JSON };
+
+struct Row {
+	std::string impl, corpus, function;
+	size_t bytes;
+	Speed speed;
+};
+
+Format format = TABLE;
+// with --impls, what is run with each of them
+std::vector<UTF_IMPL> impls;
+std::vector<Row> rows;
+
+template<class Fn>
+void row(const Corpus &c, const char *function, const std::vector<uint8_t> &input, Fn fn) {
+	if(!impls.empty()) {
+		// taking turns after a run that warms up the caches, so that the clock speed and the caches are
+		// the same for all of them
+		std::vector<Row> each;
+		for(UTF_IMPL impl : impls) each.push_back(Row{ utf_impl_name(impl), c.name, function, input.size(), Speed() });
+		measure(input.size(), fn);
+		for(int round = 0; round < 5; round++)
+			for(size_t i = 0; i < impls.size(); i++) {
+				utf_force_impl(impls[i]);
+				Speed s = measure(input.size(), fn);
+				if(s.gbps > each[i].speed.gbps) each[i].speed = s;
+			}
+		utf_force_impl(UTF_IMPL_AUTO);
+		rows.insert(rows.end(), each.begin(), each.end());
+		return;
+	}
+	Row r{ utf_impl_name(utf_get_impl()), c.name, function, input.size(), measure(input.size(), fn) };
+	if(format == TABLE) printf("%-12s %-26s %10.3f %10.2f\n", r.corpus.c_str(), r.function.c_str(), r.speed.gbps, r.speed.cycles_per_byte);
+	rows.push_back(r);
+}
+
+void print_rows(const char *impl) {
+	if(format == CSV) {
+		printf("implementation,cycles,corpus,function,bytes,gbps,cycles_per_byte\n");
+		for(auto &r : rows)
+			printf("%s,%s,%s,%s,%zu,%.4f,%.4f\n", r.impl.c_str(), cycles.source, r.corpus.c_str(), r.function.c_str(), r.bytes, r.speed.gbps, r.speed.cycles_per_byte);
+	}
+	else if(format == JSON) {
+		printf("{\n  \"implementation\": \"%s\",\n  \"cycles\": \"%s\",\n  \"results\": [\n", impl, cycles.source);
+		for(size_t i = 0; i < rows.size(); i++) {
+			auto &r = rows[i];
+			printf("    { \"implementation\": \"%s\", \"corpus\": \"%s\", \"function\": \"%s\", \"bytes\": %zu, \"gbps\": %.4f, \"cycles_per_byte\": %.4f }%s\n",
+				r.impl.c_str(), r.corpus.c_str(), r.function.c_str(), r.bytes, r.speed.gbps, r.speed.cycles_per_byte, i + 1 < rows.size() ? "," : "");
+		}
+		printf("  ]\n}\n");
+	}
+}
+
+// a row per function with the GB/s of every implementation, the picked one marked with *; where
+// another one is more than 10% faster it says so
+void print_impls() {
+	const char *picked = utf_impl_name(utf_best_impl());
+	printf("cycles: %s\n\n%-12s %-26s", cycles.source, "corpus", "function");
+	for(UTF_IMPL impl : impls) printf(" %10s", utf_impl_name(impl));
+	printf("\n");
+	size_t slower = 0, compared = 0;
+	for(auto &first : rows) {
+		if(first.impl != utf_impl_name(impls[0])) continue;
+		printf("%-12s %-26s", first.corpus.c_str(), first.function.c_str());
+		const Row *fastest = nullptr, *chosen = nullptr;
+		for(auto &r : rows) {
+			if(r.corpus != first.corpus || r.function != first.function) continue;
+			printf(" %9.3f%c", r.speed.gbps, r.impl == picked ? '*' : ' ');
+			if(!fastest || r.speed.gbps > fastest->speed.gbps) fastest = &r;
+			if(r.impl == picked) chosen = &r;
+		}
+		compared++;
+		if(chosen && fastest->speed.gbps > chosen->speed.gbps * 1.1) {
+			printf("  %s is faster", fastest->impl.c_str());
+			slower++;
+		}
+		printf("\n");
+	}
+	printf("\n%s is more than 10%% slower than another one in %zu of %zu\n", picked, slower, compared);
+}
+
+// the functions that go through the instruction set dispatch
+void bench_bulk(const Corpus &c, std::vector<uint8_t> &out) {
+	row(c, "utf8_validate", c.u8, [&] { return run_validate(c.u8); });
+	row(c, "utf8_to_utf16LE", c.u8, [&] { return run_bulk(utf8_to_utf16, c.u8, UTF8, UTF16, UTF_LE, out); });
+	row(c, "utf8_to_utf16BE", c.u8, [&] { return run_bulk(utf8_to_utf16, c.u8, UTF8, UTF16, UTF_BE, out); });
+	row(c, "utf16LE_to_utf8", c.u16le, [&] { return run_bulk(utf16_to_utf8, c.u16le, UTF16, UTF8, UTF_LE, out); });
+	row(c, "utf16BE_to_utf8", c.u16be, [&] { return run_bulk(utf16_to_utf8, c.u16be, UTF16, UTF8, UTF_BE, out); });
+	row(c, "utf8_to_utf32LE", c.u8, [&] { return run_bulk(utf8_to_utf32, c.u8, UTF8, UTF32, UTF_LE, out); });
+	row(c, "utf8_to_utf32BE", c.u8, [&] { return run_bulk(utf8_to_utf32, c.u8, UTF8, UTF32, UTF_BE, out); });
+	row(c, "utf32LE_to_utf8", c.u32le, [&] { return run_bulk(utf32_to_utf8, c.u32le, UTF32, UTF8, UTF_LE, out); });
+	row(c, "utf32BE_to_utf8", c.u32be, [&] { return run_bulk(utf32_to_utf8, c.u32be, UTF32, UTF8, UTF_BE, out); });
+	row(c, "transcode utf16LE->32LE", c.u16le, [&] { return run_transcode(c.u16le, UTF16, UTF_LE, UTF32, UTF_LE, out, 1); });
+	row(c, "transcode utf32LE->16LE", c.u32le, [&] { return run_transcode(c.u32le, UTF32, UTF_LE, UTF16, UTF_LE, out, 1); });
+	row(c, "transcode utf16LE->16BE", c.u16le, [&] { return run_transcode(c.u16le, UTF16, UTF_LE, UTF16, UTF_BE, out, 1); });
+	row(c, "utf16_swap", c.u16le, [&] { return utf16_swap(c.u16le.data(), c.u16le.size() / 2, out.data(), out.size() / 2, UTF_LE, false).num_written; });
+	row(c, "utf16_swap validate", c.u16le, [&] { return run_bulk(utf16_swap_valid, c.u16le, UTF16, UTF16, UTF_LE, out); });
+	row(c, "utf32_swap validate", c.u32le, [&] { return run_bulk(utf32_swap_valid, c.u32le, UTF32, UTF32, UTF_LE, out); });
+
+	row(c, "utf8_count_codepoints", c.u8, [&] { return utf8_count_codepoints(c.u8.data(), c.u8.size()); });
+	row(c, "utf16_length_from_utf8", c.u8, [&] { return utf16_length_from_utf8(c.u8.data(), c.u8.size()); });
+	row(c, "utf8_length_from_utf16", c.u16le, [&] { return utf8_length_from_utf16(c.u16le.data(), c.u16le.size() / 2, UTF_LE); });
+	row(c, "utf8_length_from_utf32", c.u32le, [&] { return utf8_length_from_utf32(c.u32le.data(), c.u32le.size() / 4, UTF_LE); });
+
+	// Latin-1 on both sides, the UTF-8 and Latin-1 of the same text
+	if(!c.latin1.empty()) {
+		if(c.u8.size() == c.latin1.size()) row(c, "ascii_validate", c.u8, [&] { return ascii_validate(c.u8.data(), c.u8.size()).num_read; });
+		row(c, "latin1_to_utf8", c.latin1, [&] { return run_bulk(latin1_to_utf8_bulk, c.latin1, UTF8, UTF8, UTF_LE, out); });
+		row(c, "latin1_to_utf16LE", c.latin1, [&] { return run_bulk(latin1_to_utf16, c.latin1, UTF8, UTF16, UTF_LE, out); });
+		row(c, "utf8_to_latin1", c.u8, [&] { return run_bulk(utf8_to_latin1_bulk, c.u8, UTF8, UTF8, UTF_LE, out); });
+		row(c, "utf8_length_from_latin1", c.latin1, [&] { return utf8_length_from_latin1(c.latin1.data(), c.latin1.size()); });
+	}
+}
+
+void bench_corpus(const Corpus &c, std::vector<uint8_t> &out) {
+	std::vector<char32_t> cps;
+	for(size_t i = 0; i < c.u32le.size(); i += 4) {
+		UTF_Cp p = utf32_decode_cp(c.u32le.data() + i, UTF_LE);
+		if(p.result == UTF_OK) cps.push_back(p.codepoint);
+	}
+	std::vector<uint8_t> cps_bytes(cps.size() * 4);
+
+	// the per-codepoint functions
+	row(c, "utf8_decode loop", c.u8, [&] { return loop_decode(c.u8, [](const uint8_t *s) { return utf8_decode(s); }); });
+	row(c, "utf16LE_decode loop", c.u16le, [&] { return loop_decode(c.u16le, [](const uint8_t *s) { return utf16LE_decode(s); }); });
+	row(c, "utf32LE_decode loop", c.u32le, [&] { return loop_decode(c.u32le, [](const uint8_t *s) { return utf32LE_decode(s); }); });
+	row(c, "utf8_encode loop", cps_bytes, [&] { return loop_encode(cps, UTF8, out); });
+	row(c, "utf16LE_encode loop", cps_bytes, [&] { return loop_encode(cps, UTF16, out); });
+	row(c, "utf32LE_encode loop", cps_bytes, [&] { return loop_encode(cps, UTF32, out); });
+	row(c, "utf8->utf16LE loop", c.u8, [&] { return loop_transcode(c.u8, UTF8, UTF16, UTF_LE, out); });
+	row(c, "utf16LE->utf8 loop", c.u16le, [&] { return loop_transcode(c.u16le, UTF16, UTF8, UTF_LE, out); });
+	row(c, "utf8->utf32LE loop", c.u8, [&] { return loop_transcode(c.u8, UTF8, UTF32, UTF_LE, out); });
+	row(c, "utf32LE->utf8 loop", c.u32le, [&] { return loop_transcode(c.u32le, UTF32, UTF8, UTF_LE, out); });
+	row(c, "utf16 length loop", c.u8, [&] { return loop_length(c.u8, UTF8, UTF16); });
+
+	row(c, "utf8_decode_cp", c.u8, [&] { return loop_decode(c.u8, [](const uint8_t *s) { return utf8_decode_cp(s); }); });
+	row(c, "utf16LE_decode_cp", c.u16le, [&] { return loop_decode(c.u16le, [](const uint8_t *s) { return utf16_decode_cp(s, UTF_LE); }); });
+	row(c, "utf32LE_decode_cp", c.u32le, [&] { return loop_decode(c.u32le, [](const uint8_t *s) { return utf32_decode_cp(s, UTF_LE); }); });
+	row(c, "utf8_decode_prev loop", c.u8, [&] { return loop_decode_prev(c.u8, 1, [](const uint8_t *s, size_t pos) { return utf8_decode_prev(s, pos); }); });
+	row(c, "utf16LE_decode_prev loop", c.u16le, [&] { return loop_decode_prev(c.u16le, 2, [](const uint8_t *s, size_t pos) { return utf16LE_decode_prev(s, pos); }); });
+
+	bench_bulk(c, out);
+
+	row(c, "lossy utf8->16LE", c.u8, [&] { return utf_transcode_lossy(c.u8.data(), c.u8.size(), UTF8, UTF_LE, out.data(), out.size() / 2, UTF16, UTF_LE, nullptr).num_written; });
+	row(c, "lossy utf16LE->8", c.u16le, [&] { return utf_transcode_lossy(c.u16le.data(), c.u16le.size() / 2, UTF16, UTF_LE, out.data(), out.size(), UTF8, UTF_LE, nullptr).num_written; });
+	std::vector<char32_t> col_cps(c.u8.size());
+	std::vector<uint32_t> col_offsets(c.u8.size());
+	std::vector<uint8_t> col_status(c.u8.size());
+	row(c, "utf8 columns cps", c.u8, [&] { return utf_decode_columns(c.u8.data(), c.u8.size(), UTF8, UTF_LE, col_cps.data(), nullptr, nullptr, col_cps.size()).num_written; });
+	row(c, "utf8 columns offsets", c.u8, [&] { return utf_decode_columns(c.u8.data(), c.u8.size(), UTF8, UTF_LE, nullptr, col_offsets.data(), nullptr, col_offsets.size()).num_written; });
+	row(c, "utf8 columns all", c.u8, [&] { return utf_decode_columns(c.u8.data(), c.u8.size(), UTF8, UTF_LE, col_cps.data(), col_offsets.data(), col_status.data(), col_cps.size()).num_written; });
+	row(c, "utf16LE columns cps", c.u16le, [&] { return utf_decode_columns(c.u16le.data(), c.u16le.size() / 2, UTF16, UTF_LE, col_cps.data(), nullptr, nullptr, col_cps.size()).num_written; });
+	row(c, "utf32LE columns cps", c.u32le, [&] { return utf_decode_columns(c.u32le.data(), c.u32le.size() / 4, UTF32, UTF_LE, col_cps.data(), nullptr, nullptr, col_cps.size()).num_written; });
+	row(c, "utf_compare utf8 utf8", c.u8, [&] { return utf_compare(c.u8.data(), c.u8.size(), UTF8, UTF_LE, c.u8.data(), c.u8.size() - 1, UTF8, UTF_LE) + 1; });
+	row(c, "utf_compare utf8 utf16LE", c.u8, [&] { return utf_compare(c.u8.data(), c.u8.size(), UTF8, UTF_LE, c.u16le.data(), c.u16le.size() / 2, UTF16, UTF_LE) + 1; });
+	// what they save: the same answer by transcoding one side first
+	row(c, "lossy utf8->16LE + memcmp", c.u8, [&] {
+		size_t n = utf_transcode_lossy(c.u8.data(), c.u8.size(), UTF8, UTF_LE, out.data(), out.size() / 2, UTF16, UTF_LE, nullptr).num_written;
+		return memcmp(out.data(), c.u16le.data(), n * 2 < c.u16le.size() ? n * 2 : c.u16le.size()) + 1;
+	});
+	row(c, "utf_compare utf16LE utf32LE", c.u16le, [&] { return utf_compare(c.u16le.data(), c.u16le.size() / 2, UTF16, UTF_LE, c.u32le.data(), c.u32le.size() / 4, UTF32, UTF_LE) + 1; });
+	row(c, "utf_hash utf8", c.u8, [&] { return utf_hash(c.u8.data(), c.u8.size(), UTF8, UTF_LE, 0); });
+	row(c, "utf_hash utf16LE", c.u16le, [&] { return utf_hash(c.u16le.data(), c.u16le.size() / 2, UTF16, UTF_LE, 0); });
+	row(c, "lossy utf16LE->8 + utf_hash", c.u16le, [&] {
+		size_t n = utf_transcode_lossy(c.u16le.data(), c.u16le.size() / 2, UTF16, UTF_LE, out.data(), out.size(), UTF8, UTF_LE, nullptr).num_written;
+		return utf_hash(out.data(), n, UTF8, UTF_LE, 0);
+	});
+	row(c, "utf_hash utf32LE", c.u32le, [&] { return utf_hash(c.u32le.data(), c.u32le.size() / 4, UTF32, UTF_LE, 0); });
+	// not in any of the texts, so they're searched whole
+	static const char32_t needle[] = { U'q', U'@', 0x4E00, U'z', 0x1F600 };
+	row(c, "utf_find_codepoint utf8", c.u8, [&] { return utf_find_codepoint(c.u8.data(), c.u8.size(), UTF8, UTF_LE, 0x10FFFF).byte + 1; });
+	row(c, "utf_find utf8", c.u8, [&] { return utf_find(c.u8.data(), c.u8.size(), UTF8, UTF_LE, needle, 5).byte + 1; });
+	row(c, "utf_find utf16LE", c.u16le, [&] { return utf_find(c.u16le.data(), c.u16le.size() / 2, UTF16, UTF_LE, needle, 5).byte + 1; });
+	row(c, "utf_cp_width loop", cps_bytes, [&] {
+		size_t w = 0;
+		for(char32_t cp : cps) w += utf_cp_width(cp);
+		return w;
+	});
+	row(c, "utf8_display_width", c.u8, [&] { return utf8_display_width(c.u8.data(), c.u8.size()); });
+	row(c, "utf_stream utf8->16LE", c.u8, [&] { return run_stream(c.u8, out); });
+	row(c, "parallel utf8->16LE", c.u8, [&] { return run_transcode(c.u8, UTF8, UTF_LE, UTF16, UTF_LE, out, 0); });
+	row(c, "utf8->16LE 16 KiB out", c.u8, [&] { return run_drain(c.u8, UTF8, UTF16, 1 << 14, out); });
+	row(c, "utf8->16LE 1 KiB out", c.u8, [&] { return run_drain(c.u8, UTF8, UTF16, 1 << 10, out); });
+	row(c, "utf16LE->8 16 KiB out", c.u16le, [&] { return run_drain(c.u16le, UTF16, UTF8, 1 << 14, out); });
+
+	std::vector<UTF_IndexEntry> entries(utf_index_capacity(c.u8.size(), 256));
+	row(c, "utf_index_update", c.u8, [&] { return run_index(c.u8, entries); });
+
+	row(c, "utf_detect utf8", c.u8, [&] { return run_detect(c.u8, UTF8); });
+	row(c, "utf_detect utf16LE", c.u16le, [&] { return run_detect(c.u16le, UTF16); });
+}
+
+// with --impls only the bulk functions
+void bench(const Corpus &c, std::vector<uint8_t> &out) {
+	if(impls.empty()) bench_corpus(c, out);
+	else bench_bulk(c, out);
+}
+
+int main(int argc, char **argv) {
+	for(int i = 1; i < argc; i++) {
+		if(!strcmp(argv[i], "--csv")) format = CSV;
+		else if(!strcmp(argv[i], "--json")) format = JSON;
+		else if(!strcmp(argv[i], "--impls")) {
+			for(UTF_IMPL impl = UTF_IMPL_SCALAR; impl <= utf_best_impl(); impl = static_cast<UTF_IMPL>(impl + 1)) impls.push_back(impl);
+		}
+		else {
+			bool found = false;
+			for(UTF_IMPL impl : { UTF_IMPL_SCALAR, UTF_IMPL_SSE42, UTF_IMPL_AVX2, UTF_IMPL_AVX512 }) {
+				if(strcmp(argv[i], utf_impl_name(impl))) continue;
+				found = true;
+				if(!utf_force_impl(impl)) {
+					fprintf(stderr, "%s is not supported here\n", argv[i]);
+					return 1;
+				}
+			}
+			if(!found) {
+				fprintf(stderr, "usage: %s [--csv | --json] [scalar|sse4.2|avx2|avx512bw | --impls]\n", argv[0]);
+				return 1;
+			}
+		}
+	}
+
+	const size_t n = 1 << 20;
+	std::vector<std::pair<char32_t, char32_t>> mixed = { {0x20, 0x7E}, {0x400, 0x4FF}, {0x4E00, 0x9FFF}, {0x1F300, 0x1FAFF} };
+	const char *impl = utf_impl_name(utf_get_impl());
+	if(format == TABLE && impls.empty()) {
+		printf("implementation: %s, cycles: %s\n\n", impl, cycles.source);
+		printf("%-12s %-26s %10s %10s\n", "corpus", "function", "GB/s", "cycles/B");
+	}
+
+	// one at a time, all of them at once would be a few hundred MB
+	std::vector<uint8_t> out(n * 4 * 4);
+	bench(make_corpus("ascii", { {0x20, 0x7E} }, n), out);
+	bench(make_corpus("latin1", { {0x20, 0x7E}, {0xA0, 0xFF} }, n), out);
+	bench(make_corpus("cyrillic", { {0x410, 0x44F}, {0x410, 0x44F}, {0x20, 0x40} }, n), out);
+	bench(make_corpus("cjk", { {0x4E00, 0x9FFF} }, n), out);
+	bench(make_corpus("emoji", { {0x1F300, 0x1FAFF} }, n), out);
+	bench(make_corpus("mixed", mixed, n), out);
+	bench(make_corpus("corrupt-0.1%", mixed, n, 1), out);
+	bench(make_corpus("corrupt-5%", mixed, n, 50), out);
+
+	if(!impls.empty() && format == TABLE) print_impls();
+	else print_rows(impl);
+	return 0;
+}
@@ -45,6 +45,7 @@ const char *utf_result_str(UTF_RESULT r) {
 		case UTF_TOO_FEW_WORDS: return "too few words";
 		case UTF_OVERLONG: return "overlong";
 		case UTF_ILLEGAL_CODEPOINT: return "invalid codepoint";
+		case UTF_OUTPUT_FULL: return "output full";
 		default: return "huh?";
 	}
 }
@@ -0,0 +1,172 @@
+/*
+
+	writes the tables utf_cp_width, utf_cp_category and utf8_display_width look codepoints up in into
+	utf.hpp, between the lines that start and end them there, from ucd_props.txt; nothing is downloaded
+
+	g++ -std=c++14 -O2 gen_tables.cpp -o gen_tables
+	./gen_tables [ucd_props.txt] [utf.hpp]
+
+	a codepoint is one byte, its UTF_CATEGORY and its width << 5, found in three steps: 1024 codepoints
+	at a time, then 32 at a time, then the one; the blocks of 32 and the blocks of them that repeat
+	(unassigned planes, CJK, whole scripts of one category) are kept once
+
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+
+static const char *const categories[] = {
+	"Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No", "Pc", "Pd", "Ps",
+	"Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co",
+};
+
+static const char begin_line[] = "// generated by gen_tables.cpp from ucd_props.txt, don't edit\n";
+static const char end_line[] = "// end of the generated tables\n";
+
+int category_of(const char *name) {
+	for(int i = 0; i < static_cast<int>(sizeof(categories) / sizeof(categories[0])); i++)
+		if(!strcmp(name, categories[i])) return i;
+	return -1;
+}
+
+// columns in a terminal: the marks, format and control characters and the Hangul vowels and final
+// consonants that join the syllable before them take none, wide and fullwidth ones two, the rest
+// (ambiguous ones too) one; U+00AD is shown as a hyphen
+int width_of(uint32_t cp, int category, const char *eaw) {
+	if(cp == 0xAD) return 1;
+	if((cp >= 0x1160 && cp <= 0x11FF) || (cp >= 0xD7B0 && cp <= 0xD7FF)) return 0;
+	static const char zero[] = "Mn Me Cf Cc Zl Zp";
+	if(strstr(zero, categories[category])) return 0;
+	return !strcmp(eaw, "W") || !strcmp(eaw, "F") ? 2 : 1;
+}
+
+bool read_props(const char *path, std::vector<uint8_t> &props, std::string &version) {
+	FILE *f = fopen(path, "r");
+	if(!f) return false;
+	std::vector<bool> seen(0x110000);
+	char line[256];
+	bool good = true;
+	while(good && fgets(line, sizeof(line), f)) {
+		const char *v = strstr(line, "Unicode ");
+		if(line[0] == '#' && v && version.empty()) {
+			char number[32];
+			if(sscanf(v, "Unicode %31[0-9.]", number) == 1) version = number;
+		}
+		if(line[0] == '#' || line[0] == '\n') continue;
+
+		unsigned first, last;
+		char category[8], eaw[8];
+		int n = sscanf(line, "%x..%x ; %7s ; %7s", &first, &last, category, eaw);
+		if(n != 4) {
+			n = sscanf(line, "%x ; %7s ; %7s", &first, category, eaw);
+			last = first;
+			n++;
+		}
+		int c = category_of(category);
+		good = n == 4 && first <= last && last < 0x110000 && c >= 0;
+		for(uint32_t cp = first; good && cp <= last; cp++) {
+			good = !seen[cp];
+			seen[cp] = true;
+			props[cp] = static_cast<uint8_t>(c | width_of(cp, c, eaw) << 5);
+		}
+		if(!good) fprintf(stderr, "%s: bad line: %s", path, line);
+	}
+	fclose(f);
+	for(uint32_t cp = 0; good && cp < 0x110000; cp++)
+		if(!seen[cp]) {
+			fprintf(stderr, "%s: U+%04X is missing\n", path, cp);
+			good = false;
+		}
+	return good;
+}
+
+// the distinct blocks of n in order of first use, and which one each of values is
+template<class T>
+std::vector<std::vector<T>> dedup(const std::vector<T> &values, size_t n, std::vector<uint32_t> &index) {
+	std::vector<std::vector<T>> blocks;
+	std::map<std::vector<T>, uint32_t> found;
+	for(size_t i = 0; i < values.size(); i += n) {
+		std::vector<T> b(values.begin() + i, values.begin() + i + n);
+		auto it = found.emplace(b, static_cast<uint32_t>(blocks.size())).first;
+		if(it->second == blocks.size()) blocks.push_back(b);
+		index.push_back(it->second);
+	}
+	return blocks;
+}
+
+template<class T>
+void put_row(std::string &out, const T *values, size_t n, size_t per_line, const char *indent) {
+	for(size_t i = 0; i < n; i++) {
+		out += i % per_line ? " " : indent;
+		out += std::to_string(values[i]) + ",";
+		if(i % per_line == per_line - 1 || i == n - 1) out += "\n";
+	}
+}
+
+std::string tables(const std::vector<uint8_t> &props, const std::string &version) {
+	std::vector<uint32_t> leaf_index, mid_index;
+	auto leaves = dedup(props, 32, leaf_index);
+	auto mids = dedup(leaf_index, 32, mid_index);
+	if(mids.size() > 256 || leaves.size() > 65536) return "";
+
+	std::string out = begin_line;
+	out += "// Unicode " + version + ", " + std::to_string(mid_index.size() + mids.size() * 64 + leaves.size() * 32) + " bytes\n\n";
+	out += "static const uint8_t prop_top[" + std::to_string(mid_index.size()) + "] = {\n";
+	put_row(out, mid_index.data(), mid_index.size(), 32, "\t");
+	out += "};\n\nstatic const uint16_t prop_mid[" + std::to_string(mids.size()) + "][32] = {\n";
+	for(auto &m : mids) {
+		out += "\t{\n";
+		put_row(out, m.data(), m.size(), 16, "\t\t");
+		out += "\t},\n";
+	}
+	out += "};\n\nstatic const uint8_t prop_leaf[" + std::to_string(leaves.size()) + "][32] = {\n";
+	for(auto &l : leaves) {
+		out += "\t{";
+		for(size_t i = 0; i < l.size(); i++) out += (i ? ", " : " ") + std::to_string(l[i]);
+		out += " },\n";
+	}
+	out += "};\n\n";
+	out += end_line;
+	return out;
+}
+
+int main(int argc, char **argv) {
+	const char *props_path = argc > 1 ? argv[1] : "ucd_props.txt", *header_path = argc > 2 ? argv[2] : "utf.hpp";
+	std::vector<uint8_t> props(0x110000);
+	std::string version;
+	if(!read_props(props_path, props, version)) return 1;
+	std::string generated = tables(props, version);
+	if(generated.empty()) {
+		fprintf(stderr, "too many distinct blocks for the table types\n");
+		return 1;
+	}
+
+	FILE *f = fopen(header_path, "rb");
+	if(!f) {
+		fprintf(stderr, "%s: can't read\n", header_path);
+		return 1;
+	}
+	std::string header;
+	char buf[1 << 16];
+	for(size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0;) header.append(buf, n);
+	fclose(f);
+
+	size_t begin = header.find(begin_line), end = header.find(end_line);
+	if(begin == std::string::npos || end == std::string::npos || end < begin) {
+		fprintf(stderr, "%s: no place for the tables\n", header_path);
+		return 1;
+	}
+	header.replace(begin, end + strlen(end_line) - begin, generated);
+
+	f = fopen(header_path, "wb");
+	if(!f || fwrite(header.data(), 1, header.size(), f) != header.size() || fclose(f)) {
+		fprintf(stderr, "%s: can't write\n", header_path);
+		return 1;
+	}
+	return 0;
+}
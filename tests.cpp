@@ -2,6 +2,13 @@
 
 #include <vector>
 #include <iostream>
+#include <random>
+#include <algorithm>
+#include <thread>
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 
 int utf_run_tests();
@@ -27,12 +34,14 @@ const std::vector<std::pair<std::string, std::vector<TestCase>>> testGroups = {
 			{ BOTH, UTF8, UTF_LE, 'A', {'A'}, 1, UTF_OK },
 			{ BOTH, UTF8, UTF_LE, U'猫', {0xE7, 0x8C, 0xAB}, 3, UTF_OK },
 			{ BOTH, UTF8, UTF_LE, 0x10FFFF, {0xF4, 0x8F, 0xBF, 0xBF}, 4, UTF_OK },
+			{ BOTH, UTF8, UTF_LE, 0x1D800, {0xF0, 0x9D, 0xA0, 0x80}, 4, UTF_OK },
 		}
 	},
 	{
 		"UTF-8: errors",
 		std::vector<TestCase> {
 			{ BOTH, UTF8, UTF_LE, 0xD800, {0xED, 0xA0, 0x80}, 3, UTF_ILLEGAL_CODEPOINT },
+			{ BOTH, UTF8, UTF_LE, 0xDFFF, {0xED, 0xBF, 0xBF}, 3, UTF_ILLEGAL_CODEPOINT },
 			{ BOTH, UTF8, UTF_LE, 0x110000, {0xF4, 0x90, 0x80, 0x80}, 4, UTF_ILLEGAL_CODEPOINT },
 			{ BOTH, UTF8, UTF_LE, 0xFFFFFFFF, {0xFE, 0x83, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF}, 7, UTF_ILLEGAL_CODEPOINT },
 		}
@@ -96,6 +105,56 @@ const std::vector<std::pair<std::string, std::vector<TestCase>>> testGroups = {
 	}
 };
 
+struct BulkCase {
+	std::vector<uint8_t> bytes;
+	UTF_RESULT result;
+	size_t offset;
+};
+
+const std::vector<std::pair<std::string, std::vector<BulkCase>>> validateGroups = {
+	{
+		"UTF-8: validate",
+		std::vector<BulkCase> {
+			{ {}, UTF_OK, 0 },
+			{ {'a', 'b', 'c'}, UTF_OK, 3 },
+			{ {'a', 0, 0xE7, 0x8C, 0xAB, 0xF4, 0x8F, 0xBF, 0xBF}, UTF_OK, 9 },
+			{ {'a', 'b', 0x80}, UTF_UNEXPECTED_CONTINUATION, 2 },
+			{ {'a', 0xE4, 0x80}, UTF_TOO_FEW_WORDS, 1 },
+			{ {0xE4, 0x80, 'a'}, UTF_TOO_FEW_WORDS, 0 },
+			{ {'a', 0xC0, 0xA0}, UTF_OVERLONG, 1 },
+			{ {0xF0, 0x80, 0x80, 0xA0}, UTF_OVERLONG, 0 },
+			{ {'a', 'b', 'c', 0xED, 0xA0, 0x80}, UTF_ILLEGAL_CODEPOINT, 3 },
+			{ {0xF4, 0x90, 0x80, 0x80}, UTF_ILLEGAL_CODEPOINT, 0 },
+			{ {0xFE, 0x83, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF}, UTF_ILLEGAL_CODEPOINT, 0 },
+		}
+	},
+};
+
+struct LossyCase {
+	std::vector<uint8_t> bytes;
+	std::vector<char32_t> out;
+	// unexpected continuation, too few words, overlong, illegal codepoint
+	size_t counts[4];
+};
+
+const std::vector<std::pair<std::string, std::vector<LossyCase>>> lossyGroups = {
+	{
+		"UTF-8: lossy to UTF-32",
+		std::vector<LossyCase> {
+			{ {'a', 0xE7, 0x8C, 0xAB}, {'a', U'猫'}, {0, 0, 0, 0} },
+			{ {0x80, 'a'}, {0xFFFD, 'a'}, {1, 0, 0, 0} },
+			{ {0xC0, 0x80}, {0xFFFD, 0xFFFD}, {1, 0, 1, 0} },
+			{ {0xE1, 0x80, 'A'}, {0xFFFD, 'A'}, {0, 1, 0, 0} },
+			{ {0xE0, 0x9F, 0x80}, {0xFFFD, 0xFFFD, 0xFFFD}, {2, 0, 1, 0} },
+			{ {0xED, 0xA0, 0x80}, {0xFFFD, 0xFFFD, 0xFFFD}, {2, 0, 0, 1} },
+			{ {0xF4, 0x90, 0x80, 0x80}, {0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD}, {3, 0, 0, 1} },
+			{ {0xF8, 0x88, 0x80, 0x80, 0x80}, {0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD}, {4, 0, 0, 1} },
+			{ {'a', 0xF0, 0x9F, 0x98}, {'a', 0xFFFD}, {0, 1, 0, 0} },
+			{ {0xF0, 0x9F, 0x98, 0xF0, 0x9F, 0x98, 0x80}, {0xFFFD, 0x1F600}, {0, 1, 0, 0} },
+		}
+	},
+};
+
 std::vector<std::pair<TestCase, UTF_Point>> fails;
 
 bool compare(const TestCase &tc, UTF_Point &p) {
@@ -119,6 +178,7 @@ const char *strResult(UTF_RESULT r) {
 		case UTF_TOO_FEW_WORDS: return "too few words";
 		case UTF_OVERLONG: return "overlong";
 		case UTF_ILLEGAL_CODEPOINT: return "invalid codepoint";
+		case UTF_OUTPUT_FULL: return "output full";
 		default: return "huh?";
 	}
 }
@@ -145,6 +205,106 @@ const char *st_fail = "\x1B[91mfail\x1B[m";
 const char *st_skip = "\x1B[mskip\x1B[m";
 #define LOG(x, ...) printf(x "\n", ## __VA_ARGS__)
 
+size_t word_size(UTF_TYPE t) {
+	return t == UTF8 ? 1 : t == UTF16 ? 2 : 4;
+}
+
+// random mix of encoded codepoints with a sprinkle of garbage words
+std::vector<uint8_t> random_text(std::mt19937 &rng, UTF_TYPE type, UTF_BOM bom, size_t num_points, int garbage_permille) {
+	static const char32_t ranges[][2] = { {0, 0x7F}, {0x80, 0x7FF}, {0x800, 0xFFFF}, {0x10000, 0x10FFFF} };
+	std::vector<uint8_t> ret;
+	size_t run = 4 << rng() % 6;
+	for(size_t i = 0; i < num_points; i++) {
+		if(static_cast<int>(rng() % 1000) < garbage_permille) {
+			for(size_t k = 0; k < word_size(type); k++) ret.push_back(static_cast<uint8_t>(rng()));
+			continue;
+		}
+		// runs of one range, like real text
+		auto &r = ranges[(i / run + (rng() % 64 == 0)) % 4];
+		UTF_Point p = utf_encode(r[0] + rng() % (r[1] - r[0] + 1), type, bom);
+		ret.insert(ret.end(), p.bytes, p.bytes + p.num_bytes);
+	}
+	return ret;
+}
+
+std::vector<uint8_t> random_utf8(std::mt19937 &rng, size_t num_points, int garbage_permille) {
+	return random_text(rng, UTF8, UTF_LE, num_points, garbage_permille);
+}
+
+// runs of ASCII and of the upper half, like text in a Western European language
+std::vector<uint8_t> random_latin1(std::mt19937 &rng, size_t len) {
+	std::vector<uint8_t> ret;
+	size_t run = 4 << rng() % 6;
+	for(size_t i = 0; i < len; i++)
+		ret.push_back(static_cast<uint8_t>((i / run + (rng() % 16 == 0)) % 2 ? 0x80 + rng() % 0x80 : rng() % 0x80));
+	return ret;
+}
+
+struct Transcoded {
+	UTF_Bulk status;
+	std::vector<uint8_t> bytes;
+};
+
+// per-codepoint reference, the padding stops the decoders at the end of the buffer
+Transcoded ref_transcode(const std::vector<uint8_t> &src, UTF_TYPE from, UTF_BOM from_bom, UTF_TYPE to, UTF_BOM to_bom, size_t cap = SIZE_MAX) {
+	std::vector<uint8_t> padded = src;
+	padded.resize(src.size() + 8, 0);
+	size_t len = src.size() / word_size(from);
+
+	Transcoded ret;
+	while(ret.status.num_read < len) {
+		UTF_Point p = utf_decode(padded.data() + ret.status.num_read * word_size(from), from, from_bom);
+		if(p.result != UTF_OK) {
+			ret.status.result = p.result;
+			break;
+		}
+		UTF_Point e = utf_encode(p.codepoint, to, to_bom);
+		if(e.num_words > cap - ret.status.num_written) {
+			ret.status.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		ret.bytes.insert(ret.bytes.end(), e.bytes, e.bytes + e.num_bytes);
+		ret.status.num_read += p.num_words;
+		ret.status.num_written += e.num_words;
+	}
+	return ret;
+}
+
+UTF_Bulk utf8_validate_ref(const std::vector<uint8_t> &bytes) {
+	return ref_transcode(bytes, UTF8, UTF_LE, UTF32, UTF_LE).status;
+}
+
+bool same(const UTF_Bulk &a, const UTF_Bulk &b) {
+	return a.result == b.result && a.num_read == b.num_read && a.num_written == b.num_written;
+}
+
+// runs fn on many random inputs, fn returns false on a mismatch
+template<class Fn>
+int random_group(const char *name, Fn fn) {
+	LOG("\n\n[%s]", name);
+	std::mt19937 rng(1234);
+	int nfails = 0;
+	for(int i = 0; i < 2000; i++)
+		if(!fn(rng, i)) nfails++;
+	LOG("|  %s", nfails ? st_fail : st_ok);
+	return nfails;
+}
+
+// converts with a random output capacity and checks against ref_transcode
+template<class Fn>
+bool check_transcode(std::mt19937 &rng, int i, UTF_TYPE from, UTF_BOM from_bom, UTF_TYPE to, UTF_BOM to_bom, Fn fn) {
+	auto src = random_text(rng, from, from_bom, rng() % 300, i % 3 == 0 ? 0 : 5);
+	size_t len = src.size() / word_size(from);
+	size_t cap = i % 2 ? len * 4 : rng() % (len * 2 + 1);
+
+	Transcoded ref = ref_transcode(src, from, from_bom, to, to_bom, cap);
+	std::vector<uint8_t> out(cap * word_size(to) + 1, 0xCC);
+	UTF_Bulk b = fn(src.data(), len, out.data(), cap);
+
+	return same(b, ref.status) && out[cap * word_size(to)] == 0xCC
+		&& (ref.bytes.empty() || memcmp(out.data(), ref.bytes.data(), ref.bytes.size()) == 0);
+}
+
 void print_fail(const TestCase &tc, const UTF_Point &p) {
 	printf("|    expected: (%s)", strResult(tc.result));
 	printf("\n|      0x%.6X - %s %s", static_cast<unsigned>(tc.codepoint), strType(tc.type), strBom(tc.bom));
@@ -159,6 +319,1080 @@ void print_fail(const TestCase &tc, const UTF_Point &p) {
 	printf("\n");
 }
 
+// the template layer is checked by the compiler itself
+static_assert(utf_is_valid_cp(0x10FFFF) && !utf_is_valid_cp(0xD800), "");
+static_assert(utf::decoder<UTF8>::decode(u8"猫").codepoint == U'猫', "");
+static_assert(utf::decoder<UTF8>::decode("\xC0\xA0").result == UTF_OVERLONG, "");
+static_assert(utf::decoder<UTF16, UTF_BE>::decode("\xDB\xFF\xDF\xFF").codepoint == 0x10FFFF, "");
+static_assert(utf::decoder<UTF16, UTF_LE>::decode("\x00\xD8\x41\x00").result == UTF_TOO_FEW_WORDS, "");
+static_assert(utf::decoder<UTF32, UTF_BE>::point("\x00\x10\xFF\xFF").bytes[1] == 0x10, "");
+static_assert(utf::encoder<UTF8>::encode(0x1D800).bytes[1] == 0x9D, "");
+static_assert(utf::encoder<UTF16, UTF_LE>::encode(0x10FFFF).bytes[3] == 0xDF, "");
+static_assert(utf::encoder<UTF32, UTF_BE>::encode(0x110000).result == UTF_ILLEGAL_CODEPOINT, "");
+
+constexpr auto lit16 = utf::transcode<UTF16, UTF_BE>(u8"a猫\U0001F600");
+static_assert(lit16.status.result == UTF_OK && lit16.status.num_read == 8 && lit16.status.num_written == 4, "");
+static_assert(lit16.bytes[2] == 0x73 && lit16.bytes[3] == 0x2B && lit16.bytes[4] == 0xD8 && lit16.bytes[8] == 0, "");
+constexpr auto lit8 = utf::transcode<UTF8>(U"a猫\U0001F600");
+static_assert(lit8.status.num_written == 8 && lit8.bytes[4] == 0xF0, "");
+
+// literals transcoded at compile time against utf_transcode
+template<size_t Cap>
+bool same_literal(const utf::transcoded<Cap> &t, const void *src, size_t len, UTF_TYPE from, UTF_TYPE to, UTF_BOM bom) {
+	uint8_t out[Cap];
+	UTF_Bulk b = utf_transcode(src, len, from, UTF_LE, out, Cap / word_size(to), to, bom);
+	return same(b, t.status) && memcmp(out, t.bytes, b.num_written * word_size(to)) == 0;
+}
+
+int literal_tests() {
+	LOG("\n\n[templates: literals transcoded at compile time]");
+	static const char32_t text32[] = U"Grüß Gott, 猫 \U0001F600\U0010FFFF";
+	static const char16_t text16[] = u"Grüß Gott, 猫 \U0001F600\U0010FFFF";
+	// the same in UTF-8, u8"" is char8_t in C++20
+	static const char text8[] = "Gr\xC3\xBC\xC3\x9F Gott, \xE7\x8C\xAB \xF0\x9F\x98\x80\xF4\x8F\xBF\xBF";
+	// native byte order, no way around it for utf_transcode
+	uint16_t one = 1;
+	UTF_BOM native = *reinterpret_cast<uint8_t *>(&one) ? UTF_LE : UTF_BE;
+
+	bool good = true;
+	good &= same_literal(utf::transcode<UTF16, UTF_BE>(text8), text8, sizeof(text8) - 1, UTF8, UTF16, UTF_BE);
+	good &= same_literal(utf::transcode<UTF32, UTF_LE>(text8), text8, sizeof(text8) - 1, UTF8, UTF32, UTF_LE);
+	good &= native != UTF_LE || same_literal(utf::transcode<UTF8>(text16), text16, sizeof(text16) / 2 - 1, UTF16, UTF8, UTF_LE);
+	good &= native != UTF_LE || same_literal(utf::transcode<UTF32, UTF_BE>(text32), text32, sizeof(text32) / 4 - 1, UTF32, UTF32, UTF_BE);
+	// stops at the first error like the bulk functions
+	constexpr auto bad = utf::transcode<UTF16>(u"ab\xD800" u"cd");
+	good &= bad.status.result == UTF_TOO_FEW_WORDS && bad.status.num_read == 2 && bad.status.num_written == 2;
+
+	LOG("|  %s", good ? st_ok : st_fail);
+	return !good;
+}
+
+// big inputs split over threads against the plain utf_transcode, all 36 conversions
+int parallel_tests() {
+	LOG("\n\n[utf_transcode_parallel: same as utf_transcode]");
+	std::mt19937 rng(1234);
+	int nfails = 0;
+	for(int i = 0; i < 36; i++) {
+		UTF_TYPE from = static_cast<UTF_TYPE>(i % 3), to = static_cast<UTF_TYPE>(i / 3 % 3);
+		UTF_BOM from_bom = i / 9 % 2 ? UTF_BE : UTF_LE, to_bom = i / 18 % 2 ? UTF_BE : UTF_LE;
+
+		// a few parts per thread, with one broken word now and then
+		auto piece = random_text(rng, from, from_bom, 20000, 0);
+		std::vector<uint8_t> src;
+		while(src.size() < UTF_PARALLEL_MIN * 7 / 2) src.insert(src.end(), piece.begin(), piece.end());
+		if(i % 3 == 0) {
+			size_t at = rng() % (src.size() / word_size(from)) * word_size(from);
+			for(size_t k = 0; k < word_size(from); k++) src[at + k] = static_cast<uint8_t>(rng());
+		}
+		size_t len = src.size() / word_size(from);
+		// a cap well under the input has the parts past it left out
+		size_t cap = i % 4 == 1 ? rng() % (len * 2) : i % 4 == 3 ? len / 8 + rng() % (len / 8) : len * 4 / word_size(to);
+
+		std::vector<uint8_t> ref(cap * word_size(to)), out(cap * word_size(to));
+		UTF_Bulk a = utf_transcode(src.data(), len, from, from_bom, ref.data(), cap, to, to_bom);
+		UTF_Bulk b = utf_transcode_parallel(src.data(), len, from, from_bom, out.data(), cap, to, to_bom, (i % 4) * 2);
+		if(!same(a, b) || memcmp(ref.data(), out.data(), a.num_written * word_size(to)) != 0) nfails++;
+	}
+	LOG("|  %s", nfails ? st_fail : st_ok);
+	return nfails;
+}
+
+#ifdef __linux__
+void write_all(int fd, const std::vector<uint8_t> &v) {
+	for(size_t i = 0; i < v.size();) {
+		ssize_t n = write(fd, v.data() + i, v.size() - i);
+		if(n <= 0) break;
+		i += static_cast<size_t>(n);
+	}
+}
+
+std::vector<uint8_t> read_all(int fd) {
+	std::vector<uint8_t> ret;
+	uint8_t buf[1 << 16];
+	for(ssize_t n; (n = read(fd, buf, sizeof(buf))) > 0;) ret.insert(ret.end(), buf, buf + n);
+	return ret;
+}
+
+// every conversion with a mapped input and output, with write()s to an O_WRONLY file and with read()s
+// from a pipe, against utf_transcode; some are a few batches long and big enough to be split over threads
+int file_tests() {
+	LOG("\n\n[files: mapped, written in batches and read from a pipe]");
+	std::mt19937 rng(1234);
+	char src_path[] = "/tmp/utf_test_XXXXXX", dst_path[] = "/tmp/utf_test_XXXXXX";
+	int src_fd = mkstemp(src_path), dst_fd = mkstemp(dst_path);
+	if(src_fd < 0 || dst_fd < 0) {
+		LOG("|  %s (no temporary files)", st_fail);
+		return 1;
+	}
+	close(dst_fd);
+
+	int nfails = 0;
+	for(int i = 0; i < 36; i++) {
+		UTF_TYPE from = static_cast<UTF_TYPE>(i % 3), to = static_cast<UTF_TYPE>(i / 3 % 3);
+		UTF_BOM from_bom = i / 9 % 2 ? UTF_BE : UTF_LE, to_bom = i / 18 % 2 ? UTF_BE : UTF_LE;
+		size_t ws_from = word_size(from), ws_to = word_size(to);
+
+		// a broken word now and then, a sequence or a word cut off at the end
+		auto src = random_text(rng, from, from_bom, i % 6 == 0 ? 600000 : rng() % 3000, i % 3 == 1 ? 2 : 0);
+		if(i % 4 == 3) {
+			UTF_Point p = utf_encode(0x1F600, from, from_bom);
+			src.insert(src.end(), p.bytes, p.bytes + (from == UTF32 ? 1 : p.num_bytes / 2 + 1));
+		}
+		if(ftruncate(src_fd, 0) || lseek(src_fd, 0, SEEK_SET)) return 1;
+		write_all(src_fd, src);
+
+		size_t len = src.size() / ws_from;
+		std::vector<uint8_t> ref(len * 4 + 4);
+		UTF_Bulk a = utf_transcode(src.data(), len, from, from_bom, ref.data(), ref.size() / ws_to, to, to_bom);
+		if(a.result == UTF_OK && src.size() % ws_from) a.result = UTF_TOO_FEW_WORDS;
+		ref.resize(a.num_written * ws_to);
+
+		auto check = [&](const UTF_FileBulk &f) {
+			int fd = open(dst_path, O_RDONLY);
+			bool good = fd >= 0 && !f.error && f.result == a.result && f.num_read == a.num_read && f.num_written == a.num_written
+				&& read_all(fd) == ref;
+			close(fd);
+			if(!good) nfails++;
+		};
+
+		check(utf_transcode_file(src_path, from, from_bom, dst_path, to, to_bom));
+
+		int in = open(src_path, O_RDONLY), out = open(dst_path, O_WRONLY | O_TRUNC);
+		check(utf_transcode_fd(in, from, from_bom, out, to, to_bom));
+		close(out);
+
+		// the reader may stop at an error before the writer is done, what's left is drained
+		int p[2];
+		if(pipe(p)) return 1;
+		std::thread feed([&] {
+			write_all(p[1], src);
+			close(p[1]);
+		});
+		out = open(dst_path, O_WRONLY | O_TRUNC);
+		UTF_FileBulk f = utf_transcode_fd(p[0], from, from_bom, out, to, to_bom);
+		read_all(p[0]);
+		feed.join();
+		close(p[0]);
+		close(out);
+		check(f);
+		close(in);
+	}
+
+	close(src_fd);
+	unlink(src_path);
+	unlink(dst_path);
+	LOG("|  %s", nfails ? st_fail : st_ok);
+	return nfails;
+}
+#endif
+
+static_assert(utf::decoder<UTF8>::next("\xF0\x9F\x98", 3).num_bytes == 3, "");
+static_assert(utf::decoder<UTF8>::next("\xE0\x80", 2).result == UTF_OVERLONG, "");
+static_assert(utf::decoder<UTF8>::prev("a\xF0\x9F\x98\x80", 5, 5).codepoint == 0x1F600, "");
+static_assert(utf::decoder<UTF16, UTF_BE>::next("\xD8\x3D", 2).codepoint == 0xFFFD, "");
+#ifdef __cpp_lib_ranges
+static_assert(std::ranges::bidirectional_range<utf::codepoint_view<UTF8>>);
+static_assert(std::ranges::view<utf::codepoint_view<UTF16, UTF_BE>> && std::ranges::borrowed_range<utf::codepoint_view<UTF32>>);
+#endif
+
+// the strict decoder for any encoding, len in bytes
+UTF_Cp next_cp(const uint8_t *s, size_t len, UTF_TYPE type, UTF_BOM bom) {
+	if(type == UTF8) return utf::decoder<UTF8>::next(s, len);
+	if(type == UTF16) return bom == UTF_BE ? utf::decoder<UTF16, UTF_BE>::next(s, len) : utf::decoder<UTF16, UTF_LE>::next(s, len);
+	return bom == UTF_BE ? utf::decoder<UTF32, UTF_BE>::next(s, len) : utf::decoder<UTF32, UTF_LE>::next(s, len);
+}
+
+bool same_cp(const uint8_t *s, UTF_TYPE type, UTF_BOM bom) {
+	UTF_Point p = utf_decode(s, type, bom);
+	UTF_Cp c = utf_decode_cp(s, type, bom);
+	return p.codepoint == c.codepoint && p.result == c.result && p.num_words == c.num_words && p.num_bytes == c.num_bytes;
+}
+
+// the lean decoders against the UTF_Point ones, every lead word with a few kinds of followers
+int decode_cp_tests() {
+	LOG("\n\n[lean decoders: same as the UTF_Point ones]");
+	int nfails = 0;
+
+	static const uint8_t follow[] = { 0x00, 0x41, 0x80, 0xBF };
+	for(int b0 = 0; b0 < 256; b0++)
+		for(int b1 = 0; b1 < 256; b1++)
+			for(uint8_t b2 : follow)
+				for(uint8_t b3 : follow)
+					for(uint8_t t : { 0x00, 0xBF }) {
+						uint8_t s[8] = { static_cast<uint8_t>(b0), static_cast<uint8_t>(b1), b2, b3, t, t, t, 0 };
+						if(!same_cp(s, UTF8, UTF_LE)) nfails++;
+					}
+
+	static const uint16_t next[] = { 0x0041, 0xD800, 0xDBFF, 0xDC00, 0xDFFF, 0xE000 };
+	for(UTF_BOM bom : { UTF_LE, UTF_BE })
+		for(uint32_t w = 0; w < 0x10000; w++)
+			for(uint16_t w2 : next) {
+				uint8_t s[4];
+				s[bom == UTF_LE] = w >> 8; s[bom != UTF_LE] = w & 0xFF;
+				s[2 + (bom == UTF_LE)] = w2 >> 8; s[2 + (bom != UTF_LE)] = w2 & 0xFF;
+				if(!same_cp(s, UTF16, bom)) nfails++;
+			}
+
+	std::mt19937 rng(1234);
+	for(UTF_BOM bom : { UTF_LE, UTF_BE })
+		for(int i = 0; i < 100000; i++) {
+			uint32_t x = rng() >> (rng() % 32);
+			uint8_t s[4];
+			memcpy(s, &x, 4);
+			if(!same_cp(s, UTF32, bom)) nfails++;
+		}
+
+	LOG("|  %s", nfails ? st_fail : st_ok);
+	return nfails;
+}
+
+// the WHATWG UTF-8 decoder, one U+FFFD per maximal subpart
+std::vector<char32_t> whatwg_utf8(const std::vector<uint8_t> &s, size_t *replaced) {
+	std::vector<char32_t> out;
+	char32_t cp = 0;
+	int needed = 0, seen = 0;
+	uint8_t lower = 0x80, upper = 0xBF;
+	for(size_t i = 0; i < s.size(); i++) {
+		uint8_t b = s[i];
+		if(!needed) {
+			if(b < 0x80) out.push_back(b);
+			else if(b >= 0xC2 && b <= 0xDF) { needed = 1; cp = b & 0x1F; }
+			else if(b >= 0xE0 && b <= 0xEF) { needed = 2; cp = b & 0xF; if(b == 0xE0) lower = 0xA0; if(b == 0xED) upper = 0x9F; }
+			else if(b >= 0xF0 && b <= 0xF4) { needed = 3; cp = b & 0x7; if(b == 0xF0) lower = 0x90; if(b == 0xF4) upper = 0x8F; }
+			else {
+				out.push_back(0xFFFD);
+				++*replaced;
+			}
+			continue;
+		}
+		if(b < lower || b > upper) {
+			// the byte starts over
+			out.push_back(0xFFFD);
+			++*replaced;
+			needed = seen = 0;
+			lower = 0x80, upper = 0xBF;
+			i--;
+			continue;
+		}
+		lower = 0x80, upper = 0xBF;
+		cp = cp << 6 | (b & 0x3F);
+		if(++seen == needed) {
+			out.push_back(cp);
+			needed = seen = 0;
+		}
+	}
+	if(needed) {
+		out.push_back(0xFFFD);
+		++*replaced;
+	}
+	return out;
+}
+
+// one U+FFFD per word that doesn't decode
+std::vector<char32_t> lossy_words(const std::vector<uint8_t> &s, UTF_TYPE type, UTF_BOM bom, size_t *replaced) {
+	std::vector<uint8_t> padded = s;
+	padded.resize(s.size() + 8, 0);
+	std::vector<char32_t> out;
+	for(size_t i = 0; i < s.size();) {
+		UTF_Cp c = utf_decode_cp(padded.data() + i, type, bom);
+		if(c.result != UTF_OK || i + c.num_bytes > s.size()) {
+			out.push_back(0xFFFD);
+			++*replaced;
+			i += word_size(type);
+			continue;
+		}
+		out.push_back(c.codepoint);
+		i += c.num_bytes;
+	}
+	return out;
+}
+
+std::vector<uint8_t> encode_all(const std::vector<char32_t> &cps, UTF_TYPE type, UTF_BOM bom) {
+	std::vector<uint8_t> ret;
+	for(char32_t cp : cps) {
+		UTF_Point p = utf_encode(cp, type, bom);
+		ret.insert(ret.end(), p.bytes, p.bytes + p.num_bytes);
+	}
+	return ret;
+}
+
+// forward and backward over broken text against utf_transcode_lossy
+template<UTF_TYPE T, UTF_BOM B>
+bool check_view(const std::vector<uint8_t> &src) {
+	utf::codepoint_view<T, B> view(src.data(), src.size());
+	std::vector<char32_t> fwd;
+	UTF_Errors found;
+	for(auto it = view.begin(); it != view.end(); ++it) {
+		fwd.push_back(*it);
+		found.count[it.cp().result]++;
+	}
+
+	size_t len = src.size() / word_size(T);
+	std::vector<uint8_t> expect(len * 4 + 4);
+	UTF_Errors errors;
+	UTF_Bulk b = utf_transcode_lossy(src.data(), len, T, B, expect.data(), len + 1, UTF32, UTF_LE, &errors);
+	expect.resize(b.num_written * 4);
+	bool good = encode_all(fwd, UTF32, UTF_LE) == expect;
+	for(int k = UTF_UNEXPECTED_CONTINUATION; k < UTF_OUTPUT_FULL; k++) good &= found.count[k] == errors.count[k];
+
+	// the same boundaries going back
+	std::vector<char32_t> back(std::reverse_iterator<typename utf::codepoint_view<T, B>::iterator>(view.end()),
+		std::reverse_iterator<typename utf::codepoint_view<T, B>::iterator>(view.begin()));
+	std::reverse(back.begin(), back.end());
+	good &= back == fwd && std::distance(view.begin(), view.end()) == static_cast<ptrdiff_t>(fwd.size());
+	auto it = view.end(), f = view.begin();
+	for(size_t n = 0; n < fwd.size() / 2; n++, ++f);
+	for(size_t n = fwd.size(); n > fwd.size() / 2; n--) it--;
+	good &= it == f && it.offset() == f.offset() && *it == *f;
+#ifdef __cpp_lib_ranges
+	good &= std::ranges::distance(view | std::views::reverse) == static_cast<ptrdiff_t>(fwd.size());
+#endif
+#ifdef __cpp_lib_span
+	// from a span, with a dynamic and a fixed extent
+	utf::codepoint_view<T, B> spanned(std::span<const uint8_t>(src.data(), src.size()));
+	good &= std::equal(spanned.begin(), spanned.end(), fwd.begin(), fwd.end());
+	static const uint8_t cat[3] = { 0xE7, 0x8C, 0xAB };
+	utf::codepoint_view<UTF8> fixed{ std::span<const uint8_t, 3>(cat) };
+	good &= fixed.size_bytes() == 3 && *fixed.begin() == U'\u732B';
+#endif
+	return good;
+}
+
+int view_tests() {
+	return random_group("codepoint_view: both ways against lossy", [](std::mt19937 &rng, int i) {
+		UTF_TYPE type = static_cast<UTF_TYPE>(i % 3);
+		UTF_BOM bom = i / 3 % 2 ? UTF_BE : UTF_LE;
+		auto src = random_text(rng, type, bom, rng() % 300, i % 4 == 0 ? 0 : 100);
+		// a word cut off at the end
+		if(i % 5 == 0 && !src.empty()) src.resize(src.size() - 1);
+		switch(type * 2 + bom) {
+			case UTF8 * 2 + UTF_BE: return check_view<UTF8, UTF_BE>(src);
+			case UTF8 * 2 + UTF_LE: return check_view<UTF8, UTF_LE>(src);
+			case UTF16 * 2 + UTF_BE: return check_view<UTF16, UTF_BE>(src);
+			case UTF16 * 2 + UTF_LE: return check_view<UTF16, UTF_LE>(src);
+			case UTF32 * 2 + UTF_BE: return check_view<UTF32, UTF_BE>(src);
+			default: return check_view<UTF32, UTF_LE>(src);
+		}
+	});
+}
+
+bool same_point(const UTF_Point &a, const UTF_Point &b) {
+	return a.codepoint == b.codepoint && a.result == b.result && a.num_words == b.num_words && a.num_bytes == b.num_bytes
+		&& memcmp(a.bytes, b.bytes, sizeof(a.bytes)) == 0;
+}
+
+// walking back gives what the forward decoders gave, the buffer has no padding so the sanitizers
+// catch a read at or after pos
+int decode_prev_tests() {
+	int nerrors = random_group("decode_prev: the forward walk backwards", [](std::mt19937 &rng, int i) {
+		UTF_TYPE type = static_cast<UTF_TYPE>(i % 3);
+		UTF_BOM bom = i / 3 % 2 ? UTF_BE : UTF_LE;
+		auto src = random_text(rng, type, bom, rng() % 300, i % 4 == 0 ? 0 : 100);
+		std::vector<uint8_t> padded = src;
+		padded.resize(src.size() + 8, 0);
+		size_t len = src.size() / word_size(type);
+
+		std::vector<UTF_Point> fwd;
+		for(size_t pos = 0; pos < len; pos += fwd.back().num_words)
+			fwd.push_back(utf_decode(padded.data() + pos * word_size(type), type, bom));
+
+		bool good = true;
+		size_t pos = len;
+		for(size_t k = fwd.size(); k-- > 0 && good;) {
+			UTF_Point p = utf_decode_prev(src.data(), pos, type, bom);
+			good = same_point(p, fwd[k]);
+			pos -= p.num_words;
+		}
+		return good && pos == 0 && utf_decode_prev(src.data(), 0, type, bom).num_words == 0;
+	});
+
+	nerrors += random_group("boundary: at or before n", [](std::mt19937 &rng, int i) {
+		auto s = random_utf8(rng, rng() % 100, i % 3 == 0 ? 0 : 50);
+		auto s16 = random_text(rng, UTF16, i % 2 ? UTF_BE : UTF_LE, rng() % 100, i % 3 == 0 ? 0 : 50);
+		size_t len = s.size(), len16 = s16.size() / 2;
+		bool valid = utf8_validate(s.data(), len).result == UTF_OK, good = true;
+		for(size_t n = 0; n <= len + 1; n++) {
+			// the nearest byte that isn't a continuation, no further back than 3
+			size_t ref = n >= len ? len : n;
+			for(size_t k = 0; n < len && k < 4; k++)
+				if(n - k == 0 || (s[n - k] & 0xC0) != 0x80) {
+					ref = n - k;
+					break;
+				}
+			size_t b = utf8_boundary(s.data(), len, n);
+			good &= b == ref && (!valid || utf8_validate(s.data(), b).result == UTF_OK);
+		}
+		for(size_t n = 0; n <= len16 + 1; n++) {
+			UTF_BOM bom = i % 2 ? UTF_BE : UTF_LE;
+			size_t b = utf16_boundary(s16.data(), len16, n, bom);
+			size_t ref = n >= len16 ? len16 : n;
+			if(n < len16 && n > 0 && utf16_decode(s16.data() + n * 2 - 2, bom).num_words == 2) ref = n - 1;
+			good &= b == ref;
+		}
+		return good;
+	});
+	return nerrors;
+}
+
+// known codepoints, and the widths of all of them against the categories they're derived from
+int props_tests() {
+	LOG("\n\n[properties: width and category]");
+	struct Known {
+		char32_t cp;
+		int width;
+		UTF_CATEGORY category;
+	};
+	static const Known known[] = {
+		{ U'A', 1, UTF_CAT_Lu }, { U'\t', 0, UTF_CAT_Cc }, { U' ', 1, UTF_CAT_Zs }, { 0xAD, 1, UTF_CAT_Cf },
+		{ 0xE9, 1, UTF_CAT_Ll }, { 0x301, 0, UTF_CAT_Mn }, { 0x1160, 0, UTF_CAT_Lo }, { 0x200B, 0, UTF_CAT_Cf },
+		{ 0x3000, 2, UTF_CAT_Zs }, { 0x732B, 2, UTF_CAT_Lo }, { 0xAC00, 2, UTF_CAT_Lo }, { 0xD800, 1, UTF_CAT_Cs },
+		{ 0xFF21, 2, UTF_CAT_Lu }, { 0xFFFD, 1, UTF_CAT_So }, { 0x1F600, 2, UTF_CAT_So }, { 0x20000, 2, UTF_CAT_Lo },
+		{ 0xE0001, 0, UTF_CAT_Cf }, { 0x10FFFF, 1, UTF_CAT_Cn }, { 0x110000, 1, UTF_CAT_So },
+	};
+	int nfails = 0;
+	for(auto &k : known)
+		if(utf_cp_width(k.cp) != k.width || utf_cp_category(k.cp) != k.category) nfails++;
+
+	for(char32_t cp = 0; cp < 0x110000; cp++) {
+		UTF_CATEGORY c = utf_cp_category(cp);
+		bool zero = c == UTF_CAT_Mn || c == UTF_CAT_Me || c == UTF_CAT_Cf || c == UTF_CAT_Cc || c == UTF_CAT_Zl || c == UTF_CAT_Zp;
+		zero = (zero && cp != 0xAD) || (cp >= 0x1160 && cp <= 0x11FF) || (cp >= 0xD7B0 && cp <= 0xD7FF);
+		if(zero != (utf_cp_width(cp) == 0) || c > UTF_CAT_Co) nfails++;
+	}
+	LOG("|  %s", nfails ? st_fail : st_ok);
+	return nfails;
+}
+
+// everything that goes through the selected implementation
+int bulk_tests() {
+	int nerrors = 0;
+
+	for(auto &group : validateGroups) {
+
+		LOG("\n\n[%s] (%zu)", group.first.c_str(), group.second.size());
+
+		int i = 1;
+		for(auto &bc : group.second) {
+			UTF_Bulk b = utf8_validate(bc.bytes.data(), bc.bytes.size());
+			bool good = b.result == bc.result && b.num_read == bc.offset;
+			LOG("|\n| %i: %s", i++, good ? st_ok : st_fail);
+			if(!good) {
+				nerrors++;
+				LOG("|    expected: (%s) at %zu", strResult(bc.result), bc.offset);
+				LOG("|    got: (%s) at %zu", strResult(b.result), b.num_read);
+			}
+		}
+	}
+
+	nerrors += random_group("UTF-8: validate against utf8_decode", [](std::mt19937 &rng, int i) {
+		auto bytes = random_utf8(rng, rng() % 300, i % 3 == 0 ? 0 : 5);
+		UTF_Bulk b = utf8_validate(bytes.data(), bytes.size()), ref = utf8_validate_ref(bytes);
+		return b.result == ref.result && b.num_read == ref.num_read;
+	});
+
+	for(UTF_BOM bom : { UTF_LE, UTF_BE }) {
+		nerrors += random_group(bom == UTF_LE ? "UTF-8 -> UTF-16LE" : "UTF-8 -> UTF-16BE", [bom](std::mt19937 &rng, int i) {
+			return check_transcode(rng, i, UTF8, UTF_LE, UTF16, bom, [bom](const void *src, size_t len, void *dst, size_t cap) {
+				return utf8_to_utf16(src, len, dst, cap, bom);
+			});
+		});
+		nerrors += random_group(bom == UTF_LE ? "UTF-16LE -> UTF-8" : "UTF-16BE -> UTF-8", [bom](std::mt19937 &rng, int i) {
+			return check_transcode(rng, i, UTF16, bom, UTF8, UTF_LE, [bom](const void *src, size_t len, void *dst, size_t cap) {
+				return utf16_to_utf8(src, len, dst, cap, bom);
+			});
+		});
+		nerrors += random_group(bom == UTF_LE ? "UTF-8 -> UTF-32LE" : "UTF-8 -> UTF-32BE", [bom](std::mt19937 &rng, int i) {
+			return check_transcode(rng, i, UTF8, UTF_LE, UTF32, bom, [bom](const void *src, size_t len, void *dst, size_t cap) {
+				return utf8_to_utf32(src, len, dst, cap, bom);
+			});
+		});
+		nerrors += random_group(bom == UTF_LE ? "UTF-32LE -> UTF-8" : "UTF-32BE -> UTF-8", [bom](std::mt19937 &rng, int i) {
+			return check_transcode(rng, i, UTF32, bom, UTF8, UTF_LE, [bom](const void *src, size_t len, void *dst, size_t cap) {
+				return utf32_to_utf8(src, len, dst, cap, bom);
+			});
+		});
+		UTF_BOM other = bom == UTF_LE ? UTF_BE : UTF_LE;
+		nerrors += random_group(bom == UTF_LE ? "UTF-16LE -> UTF-16BE" : "UTF-16BE -> UTF-16LE", [bom, other](std::mt19937 &rng, int i) {
+			return check_transcode(rng, i, UTF16, bom, UTF16, other, [bom](const void *src, size_t len, void *dst, size_t cap) {
+				return utf16_swap(src, len, dst, cap, bom, true);
+			});
+		});
+		nerrors += random_group(bom == UTF_LE ? "UTF-32LE -> UTF-32BE" : "UTF-32BE -> UTF-32LE", [bom, other](std::mt19937 &rng, int i) {
+			return check_transcode(rng, i, UTF32, bom, UTF32, other, [bom](const void *src, size_t len, void *dst, size_t cap) {
+				return utf32_swap(src, len, dst, cap, bom, true);
+			});
+		});
+	}
+
+	// in place gives what a separate output does and leaves the rest alone, without validation it's
+	// every word reversed
+	nerrors += random_group("swap: in place, with and without validation", [](std::mt19937 &rng, int i) {
+		UTF_TYPE type = i % 2 ? UTF16 : UTF32;
+		UTF_BOM bom = i / 2 % 2 ? UTF_BE : UTF_LE;
+		bool validate = i / 4 % 2;
+		auto swap = type == UTF16 ? utf16_swap : utf32_swap;
+		auto src = random_text(rng, type, bom, rng() % 300, i % 3 == 0 ? 0 : 5);
+		size_t ws = word_size(type), len = src.size() / ws;
+
+		std::vector<uint8_t> out(src.size()), in_place = src;
+		UTF_Bulk a = swap(src.data(), len, out.data(), len, bom, validate);
+		UTF_Bulk b = swap(in_place.data(), len, in_place.data(), len, bom, validate);
+		bool good = same(a, b) && (src.empty() || memcmp(in_place.data(), out.data(), a.num_written * ws) == 0)
+			&& (src.empty() || memcmp(in_place.data() + a.num_read * ws, src.data() + a.num_read * ws, src.size() - a.num_read * ws) == 0);
+		if(validate) return good;
+
+		for(size_t k = 0; k < src.size(); k++) good &= out[k] == src[k / ws * ws + ws - 1 - k % ws];
+		return good && a.result == UTF_OK && a.num_read == len && a.num_written == len;
+	});
+
+	// most of them pairs, so some cross every 16 bytes, some the same in both byte orders, and one bad
+	// word: a lone low surrogate, or U+41000000 that is U+41 in the other byte order
+	nerrors += random_group("swap: pairs before a bad word", [](std::mt19937 &rng, int i) {
+		UTF_TYPE type = i % 2 ? UTF16 : UTF32;
+		UTF_BOM bom = i / 2 % 2 ? UTF_BE : UTF_LE, other = bom == UTF_LE ? UTF_BE : UTF_LE;
+		size_t num_points = rng() % 100, bad = rng() % (num_points + 1);
+		std::vector<uint8_t> src;
+		for(size_t k = 0; k < num_points; k++) {
+			char32_t cp = rng() % 3 ? 0x10000 + rng() % 0x100000 : 0x10100 * (rng() % 17);
+			UTF_Point p = utf_encode(cp, type, bom);
+			if(k == bad) {
+				uint32_t w = type == UTF16 ? 0xDC00 : 0x41000000;
+				p.num_bytes = static_cast<uint8_t>(word_size(type));
+				for(size_t b = 0; b < p.num_bytes; b++) p.bytes[b] = static_cast<uint8_t>(w >> (bom == UTF_BE ? (p.num_bytes - 1 - b) * 8 : b * 8));
+			}
+			src.insert(src.end(), p.bytes, p.bytes + p.num_bytes);
+		}
+
+		size_t len = src.size() / word_size(type);
+		std::vector<uint8_t> out(src.size());
+		UTF_Bulk b = (type == UTF16 ? utf16_swap : utf32_swap)(src.data(), len, out.data(), len, bom, true);
+		Transcoded ref = ref_transcode(src, type, bom, type, other, len);
+		return same(b, ref.status) && std::equal(ref.bytes.begin(), ref.bytes.end(), out.begin());
+	});
+
+	// every pair of encodings, the input split into random pieces and written out through a small buffer
+	nerrors += random_group("UTF_Stream: random pieces", [](std::mt19937 &rng, int i) {
+		UTF_TYPE from = static_cast<UTF_TYPE>(i % 3), to = static_cast<UTF_TYPE>(i / 3 % 3);
+		UTF_BOM from_bom = i / 9 % 2 ? UTF_BE : UTF_LE, to_bom = i / 18 % 2 ? UTF_BE : UTF_LE;
+		auto src = random_text(rng, from, from_bom, rng() % 300, i % 5 == 0 ? 5 : 0);
+		Transcoded ref = ref_transcode(src, from, from_bom, to, to_bom);
+
+		UTF_Stream st = utf_stream(from, from_bom, to, to_bom);
+		std::vector<uint8_t> out;
+		uint8_t buf[64 * 4];
+		UTF_RESULT res = UTF_OK;
+		for(size_t pos = 0; pos < src.size() && res == UTF_OK;) {
+			size_t len = std::min<size_t>(src.size() - pos, rng() % 12 == 0 ? rng() % 200 : rng() % 8);
+			for(size_t done = 0; done < len;) {
+				UTF_Bulk b = utf_stream_write(&st, src.data() + pos + done, len - done, buf, rng() % 64);
+				out.insert(out.end(), buf, buf + b.num_written * word_size(to));
+				done += b.num_read;
+				if(b.result != UTF_OUTPUT_FULL) {
+					res = b.result;
+					if(res != UTF_OK) break;
+				}
+			}
+			pos += len;
+		}
+		res = utf_stream_end(&st);
+
+		return res == ref.status.result && out == ref.bytes;
+	});
+
+	// a fixed-size buffer flushed after every call, the pieces together are the one-shot output and a call
+	// only comes back full without room for the largest codepoint
+	nerrors += random_group("bounded output: drained through a small buffer", [](std::mt19937 &rng, int i) {
+		UTF_TYPE from = static_cast<UTF_TYPE>(i % 3), to = static_cast<UTF_TYPE>(i / 3 % 3);
+		UTF_BOM from_bom = i / 9 % 2 ? UTF_BE : UTF_LE, to_bom = i / 18 % 2 ? UTF_BE : UTF_LE;
+		bool lossy = i / 36 % 2;
+		auto src = random_text(rng, from, from_bom, rng() % 600, i % 5 == 0 ? 5 : 0);
+		size_t len = src.size() / word_size(from), ws = word_size(to), need = 4 / ws, cap = need + rng() % 40;
+
+		auto fn = [&](size_t pos, uint8_t *dst, size_t room) {
+			const uint8_t *s = src.data() + pos * word_size(from);
+			return lossy ? utf_transcode_lossy(s, len - pos, from, from_bom, dst, room, to, to_bom, nullptr)
+				: utf_transcode(s, len - pos, from, from_bom, dst, room, to, to_bom);
+		};
+		std::vector<uint8_t> all(len * 4 + 4);
+		UTF_Bulk one = fn(0, all.data(), len * 4 / ws + 1);
+
+		std::vector<uint8_t> buf(cap * ws + 1, 0xCC), out;
+		UTF_Bulk total;
+		bool good = true;
+		for(;;) {
+			UTF_Bulk b = fn(total.num_read, buf.data(), cap);
+			out.insert(out.end(), buf.data(), buf.data() + b.num_written * ws);
+			total.num_read += b.num_read;
+			total.num_written += b.num_written;
+			total.result = b.result;
+			good &= buf[cap * ws] == 0xCC;
+			if(b.result != UTF_OUTPUT_FULL) break;
+			if(!b.num_written || cap - b.num_written >= need) {
+				good = false;
+				break;
+			}
+		}
+		return good && same(total, one) && std::equal(out.begin(), out.end(), all.begin()) && out.size() == one.num_written * ws;
+	});
+
+	for(auto &group : lossyGroups) {
+
+		LOG("\n\n[%s] (%zu)", group.first.c_str(), group.second.size());
+
+		int i = 1;
+		for(auto &lc : group.second) {
+			UTF_Errors errors;
+			std::vector<char32_t> out(lc.bytes.size() + 1, 0xCCCC);
+			UTF_Bulk b = utf_transcode_lossy(lc.bytes.data(), lc.bytes.size(), UTF8, UTF_LE, out.data(), out.size(), UTF32, UTF_LE, &errors);
+			out.resize(b.num_written);
+			bool good = b.result == UTF_OK && b.num_read == lc.bytes.size() && out == lc.out && errors.count[UTF_OK] == 0;
+			for(int k = 0; k < 4; k++) good &= errors.count[UTF_UNEXPECTED_CONTINUATION + k] == lc.counts[k];
+			LOG("|\n| %i: %s", i++, good ? st_ok : st_fail);
+			if(!good) nerrors++;
+		}
+	}
+
+	// random mostly broken text, every conversion
+	nerrors += random_group("lossy: against WHATWG and word by word", [](std::mt19937 &rng, int i) {
+		UTF_TYPE from = static_cast<UTF_TYPE>(i % 3), to = static_cast<UTF_TYPE>(i / 3 % 3);
+		UTF_BOM from_bom = i / 9 % 2 ? UTF_BE : UTF_LE, to_bom = i / 18 % 2 ? UTF_BE : UTF_LE;
+		auto src = random_text(rng, from, from_bom, rng() % 300, i % 4 == 0 ? 0 : 100);
+		size_t expect_replaced = 0;
+		std::vector<uint8_t> expect = encode_all(from == UTF8 ? whatwg_utf8(src, &expect_replaced) : lossy_words(src, from, from_bom, &expect_replaced), to, to_bom);
+
+		size_t len = src.size() / word_size(from), need = expect.size() / word_size(to);
+		size_t cap = i % 5 == 0 ? rng() % (need + 1) : need;
+		std::vector<uint8_t> out(cap * word_size(to) + 1, 0xCC);
+		UTF_Errors errors;
+		UTF_Bulk b = utf_transcode_lossy(src.data(), len, from, from_bom, out.data(), cap, to, to_bom, &errors);
+
+		size_t replaced = 0;
+		for(size_t n : errors.count) replaced += n;
+		bool good = out[cap * word_size(to)] == 0xCC && (!b.num_written || memcmp(out.data(), expect.data(), b.num_written * word_size(to)) == 0);
+		if(cap == need) return good && b.result == UTF_OK && b.num_read == len && b.num_written == need && replaced == expect_replaced;
+		return good && (b.result == UTF_OUTPUT_FULL || b.num_written == need);
+	});
+
+	// built from random pieces with too few entries now and then, every offset against a walk with the view
+	nerrors += random_group("index: every offset in every unit", [](std::mt19937 &rng, int i) {
+		// the first one over a few blocks of validation
+		auto text = random_utf8(rng, i == 0 ? 100000 : rng() % 300, i % 4 == 0 ? 0 : 30);
+		std::vector<UTF_Offset> ref(1);
+		utf::codepoint_view<UTF8> view(text.data(), text.size());
+		for(auto it = view.begin(); it != view.end(); ++it) {
+			UTF_Offset o = ref.back();
+			o.codepoint++;
+			o.byte += it.cp().num_bytes;
+			o.unit16 += *it >= 0x10000 ? 2 : 1;
+			ref.push_back(o);
+		}
+		// a sequence cut off at the very end isn't indexed yet
+		if(text.size() && std::prev(view.end()).cp().result == UTF_TOO_FEW_WORDS) ref.pop_back();
+
+		uint32_t step = i % 3 == 0 ? 1 + rng() % 8 : 32 + rng() % 100;
+		std::vector<UTF_IndexEntry> entries(i % 2 ? utf_index_capacity(text.size(), step) : 1);
+		UTF_Index ix = utf_index(entries.data(), entries.size(), step);
+		bool good = true;
+		for(size_t len = 0; len < text.size();) {
+			len += std::min<size_t>(text.size() - len, i == 0 ? text.size() / 2 + 1 : rng() % 200);
+			while(utf_index_update(&ix, text.data(), len) == UTF_OUTPUT_FULL) {
+				good &= ix.num_entries == ix.cap;
+				entries.resize(entries.size() * 2);
+				ix.entries = entries.data();
+				ix.cap = entries.size();
+			}
+		}
+		good &= ix.num_codepoints == ref.back().codepoint && ix.num_bytes == ref.back().byte && ix.num_units16 == ref.back().unit16;
+		good &= ix.num_entries == (ref.size() - 1 + step - 1) / step;
+
+		auto same_offset = [](const UTF_Offset &a, const UTF_Offset &b) {
+			return a.codepoint == b.codepoint && a.byte == b.byte && a.unit16 == b.unit16;
+		};
+		for(size_t k = 0; k < ref.size(); k += i == 0 ? 97 : 1) {
+			good &= same_offset(utf_index_find(&ix, text.data(), UTF_UNIT_CODEPOINT, k), ref[k]);
+			// every byte and unit inside a codepoint finds where it starts
+			for(size_t b = ref[k].byte; b < (k + 1 < ref.size() ? ref[k + 1].byte : ref[k].byte + 1); b++)
+				good &= same_offset(utf_index_find(&ix, text.data(), UTF_UNIT_BYTE, b), ref[k]);
+			for(size_t u = ref[k].unit16; u < (k + 1 < ref.size() ? ref[k + 1].unit16 : ref[k].unit16 + 1); u++)
+				good &= same_offset(utf_index_find(&ix, text.data(), UTF_UNIT_UTF16, u), ref[k]);
+		}
+		return good;
+	});
+
+	// text in one script (as real text is) with spaces, in a random encoding and now and then with a BOM,
+	// long enough now and then that only the sample is looked at
+	nerrors += random_group("detect: text in one script, every encoding", [](std::mt19937 &rng, int i) {
+		static const char32_t scripts[][2] = {
+			{ 'a', 'z' }, { 0xE0, 0xFF }, { 0x3B1, 0x3C9 }, { 0x410, 0x44F }, { 0x5D0, 0x5EA },
+			{ 0x3041, 0x3096 }, { 0x4E00, 0x9FFF }, { 0xAC00, 0xD7A3 }, { 0x1F600, 0x1F64F }
+		};
+		auto &sc = scripts[rng() % 9];
+		UTF_TYPE type = static_cast<UTF_TYPE>(rng() % 3);
+		UTF_BOM bom = type == UTF8 ? UTF_LE : static_cast<UTF_BOM>(rng() % 2);
+		bool with_bom = i % 5 == 0;
+		std::vector<uint8_t> text;
+		size_t n = i % 10 == 0 ? 3000 : 8 + rng() % 200;
+		for(size_t k = 0; k < n + with_bom; k++) {
+			char32_t c = k == 0 && with_bom ? 0xFEFF : rng() % 6 == 0 ? ' ' : sc[0] + rng() % (sc[1] - sc[0] + 1);
+			UTF_Point p = utf_encode(c, type, bom);
+			text.insert(text.end(), p.bytes, p.bytes + p.num_bytes);
+		}
+		UTF_Detected d = utf_detect(text.data(), text.size());
+		bool good = d.type == type && d.bom == bom && d.confidence > 0;
+		if(with_bom) good &= d.confidence == 100 && d.bom_bytes == word_size(type) * (type == UTF8 ? 3 : 1);
+		return good && (with_bom || !d.bom_bytes);
+	});
+	{
+		std::mt19937 rng(1234);
+		std::vector<uint8_t> noise(10000);
+		for(auto &b : noise) b = static_cast<uint8_t>(rng());
+		UTF_Detected empty = utf_detect("", 0), binary = utf_detect(noise.data(), noise.size()), zeros = utf_detect(std::vector<uint8_t>(64).data(), 64);
+		bool good = empty.confidence == 0 && binary.confidence < 10 && zeros.confidence == 0;
+		LOG("\n\n[detect: nothing to go on]\n|  %s", good ? st_ok : st_fail);
+		nerrors += !good;
+	}
+
+	// exact on valid text, never less than the transcoder writes otherwise
+	auto check_length = [](std::mt19937 &rng, int i, UTF_TYPE from, UTF_BOM bom, UTF_TYPE to, size_t (*fn)(const std::vector<uint8_t> &, UTF_BOM)) {
+		auto src = random_text(rng, from, bom, rng() % 300, i % 3 == 0 ? 0 : 5);
+		UTF_Bulk ref = ref_transcode(src, from, bom, to, UTF_LE).status;
+		size_t n = fn(src, bom);
+		return ref.result == UTF_OK ? n == ref.num_written : n >= ref.num_written;
+	};
+
+	nerrors += random_group("UTF-8: count codepoints", [&](std::mt19937 &rng, int i) {
+		return check_length(rng, i, UTF8, UTF_LE, UTF32, [](const std::vector<uint8_t> &s, UTF_BOM) {
+			return utf8_count_codepoints(s.data(), s.size());
+		});
+	});
+	nerrors += random_group("UTF-8: UTF-16 length", [&](std::mt19937 &rng, int i) {
+		return check_length(rng, i, UTF8, UTF_LE, UTF16, [](const std::vector<uint8_t> &s, UTF_BOM) {
+			return utf16_length_from_utf8(s.data(), s.size());
+		});
+	});
+	for(UTF_BOM bom : { UTF_LE, UTF_BE }) {
+		nerrors += random_group(bom == UTF_LE ? "UTF-16LE: UTF-8 length" : "UTF-16BE: UTF-8 length", [&](std::mt19937 &rng, int i) {
+			return check_length(rng, i, UTF16, bom, UTF8, [](const std::vector<uint8_t> &s, UTF_BOM en) {
+				return utf8_length_from_utf16(s.data(), s.size() / 2, en);
+			});
+		});
+		nerrors += random_group(bom == UTF_LE ? "UTF-32LE: UTF-8 length" : "UTF-32BE: UTF-8 length", [&](std::mt19937 &rng, int i) {
+			return check_length(rng, i, UTF32, bom, UTF8, [](const std::vector<uint8_t> &s, UTF_BOM en) {
+				return utf8_length_from_utf32(s.data(), s.size() / 4, en);
+			});
+		});
+	}
+
+	nerrors += random_group("ASCII: validate", [](std::mt19937 &rng, int i) {
+		auto src = random_latin1(rng, rng() % 300);
+		if(i % 2)
+			for(auto &b : src) b &= 0x7F;
+		if(i % 4 == 1 && !src.empty()) src[rng() % src.size()] |= 0x80;
+		size_t first = 0;
+		while(first < src.size() && src[first] < 0x80) first++;
+		UTF_Bulk b = ascii_validate(src.data(), src.size());
+		return b.num_read == first && b.result == (first == src.size() ? UTF_OK : UTF_ILLEGAL_CODEPOINT);
+	});
+
+	// Latin-1 goes through the reference as UTF-32
+	auto check_latin1 = [](std::mt19937 &rng, int i, UTF_TYPE to, UTF_BOM bom, UTF_Bulk (*fn)(const void *, size_t, void *, size_t, UTF_BOM)) {
+		auto src = random_latin1(rng, rng() % 300);
+		std::vector<uint8_t> wide;
+		for(uint8_t b : src) {
+			UTF_Point p = utf32_encode(b, UTF_LE);
+			wide.insert(wide.end(), p.bytes, p.bytes + p.num_bytes);
+		}
+		size_t cap = i % 2 ? src.size() * 2 : rng() % (src.size() * 2 + 1);
+
+		Transcoded ref = ref_transcode(wide, UTF32, UTF_LE, to, bom, cap);
+		std::vector<uint8_t> out(cap * word_size(to) + 1, 0xCC);
+		UTF_Bulk b = fn(src.data(), src.size(), out.data(), cap, bom);
+		bool good = same(b, ref.status) && out[cap * word_size(to)] == 0xCC
+			&& (ref.bytes.empty() || memcmp(out.data(), ref.bytes.data(), ref.bytes.size()) == 0);
+		if(to == UTF8) good &= utf8_length_from_latin1(src.data(), src.size()) == ref_transcode(wide, UTF32, UTF_LE, UTF8, UTF_LE).status.num_written;
+		return good;
+	};
+
+	nerrors += random_group("Latin-1 -> UTF-8", [&](std::mt19937 &rng, int i) {
+		return check_latin1(rng, i, UTF8, UTF_LE, [](const void *src, size_t len, void *dst, size_t cap, UTF_BOM) {
+			return latin1_to_utf8(src, len, dst, cap);
+		});
+	});
+	for(UTF_BOM bom : { UTF_LE, UTF_BE }) {
+		nerrors += random_group(bom == UTF_LE ? "Latin-1 -> UTF-16LE" : "Latin-1 -> UTF-16BE", [&](std::mt19937 &rng, int i) {
+			return check_latin1(rng, i, UTF16, bom, latin1_to_utf16);
+		});
+	}
+
+	// with a codepoint over U+00FF or a garbage byte now and then
+	nerrors += random_group("UTF-8 -> Latin-1", [](std::mt19937 &rng, int i) {
+		auto text = random_latin1(rng, rng() % 300);
+		std::vector<char32_t> cps(text.begin(), text.end());
+		if(i % 4 == 1 && !cps.empty()) cps[rng() % cps.size()] = 0x100 + rng() % (0xD800 - 0x100);
+		std::vector<uint8_t> src;
+		for(char32_t cp : cps) {
+			UTF_Point p = utf8_encode(cp);
+			src.insert(src.end(), p.bytes, p.bytes + p.num_bytes);
+		}
+		if(i % 4 == 2 && !src.empty()) src[rng() % src.size()] = static_cast<uint8_t>(rng());
+		size_t cap = i % 2 ? src.size() : rng() % (cps.size() + 1);
+
+		std::vector<uint8_t> padded = src;
+		padded.resize(src.size() + 8, 0);
+		Transcoded ref;
+		while(ref.status.num_read < src.size()) {
+			UTF_Point p = utf8_decode(padded.data() + ref.status.num_read);
+			if(p.result != UTF_OK) ref.status.result = p.result;
+			else if(p.codepoint > 0xFF) ref.status.result = UTF_ILLEGAL_CODEPOINT;
+			else if(ref.status.num_written == cap) ref.status.result = UTF_OUTPUT_FULL;
+			if(ref.status.result != UTF_OK) break;
+			ref.bytes.push_back(static_cast<uint8_t>(p.codepoint));
+			ref.status.num_read += p.num_words;
+			ref.status.num_written++;
+		}
+
+		std::vector<uint8_t> out(cap + 1, 0xCC);
+		UTF_Bulk b = utf8_to_latin1(src.data(), src.size(), out.data(), cap);
+		return same(b, ref.status) && out[cap] == 0xCC
+			&& (ref.bytes.empty() || memcmp(out.data(), ref.bytes.data(), ref.bytes.size()) == 0);
+	});
+
+	// the codepoints against the lossy references, offsets and status against a walk with the strict decoder,
+	// any of the columns left out
+	nerrors += random_group("decode columns: against lossy", [](std::mt19937 &rng, int i) {
+		UTF_TYPE type = i % 2 ? static_cast<UTF_TYPE>(1 + rng() % 2) : UTF8;
+		UTF_BOM bom = rng() % 2 ? UTF_BE : UTF_LE;
+		auto src = random_text(rng, type, bom, i % 8 == 0 ? 3000 : rng() % 300, i % 3 == 0 ? 0 : 20);
+		size_t replaced, len = src.size() / word_size(type);
+		std::vector<char32_t> expect = type == UTF8 ? whatwg_utf8(src, &replaced) : lossy_words(src, type, bom, &replaced);
+
+		std::vector<uint32_t> expect_offsets;
+		std::vector<uint8_t> expect_status;
+		for(size_t pos = 0; pos < src.size();) {
+			UTF_Cp c = next_cp(src.data() + pos, src.size() - pos, type, bom);
+			expect_offsets.push_back(static_cast<uint32_t>(pos));
+			expect_status.push_back(c.result);
+			pos += c.num_words * word_size(type);
+		}
+
+		size_t cap = i % 5 == 0 ? rng() % (expect.size() + 1) : expect.size() + rng() % 2;
+		std::vector<char32_t> cps(cap + 1, 0xCCCC);
+		std::vector<uint32_t> offsets(cap + 1, 0xCCCC);
+		std::vector<uint8_t> status(cap + 1, 0xCC);
+		bool use_cps = i % 7 != 1, use_offsets = i % 7 != 2, use_status = i % 7 != 3;
+		UTF_Bulk b = utf_decode_columns(src.data(), len, type, bom, use_cps ? cps.data() : nullptr,
+			use_offsets ? offsets.data() : nullptr, use_status ? status.data() : nullptr, cap);
+
+		size_t n = b.num_written;
+		bool good = expect.size() == expect_offsets.size() && n <= cap && n <= expect.size();
+		good &= b.result == (n == expect.size() ? UTF_OK : UTF_OUTPUT_FULL) && (b.result == UTF_OK || n == cap);
+		good &= b.num_read == (n == expect.size() ? len : expect_offsets[n] / word_size(type));
+		good &= cps[cap] == 0xCCCC && offsets[cap] == 0xCCCC && status[cap] == 0xCC;
+		for(size_t k = 0; k < n && good; k++) {
+			good &= !use_cps || cps[k] == expect[k];
+			good &= !use_offsets || offsets[k] == expect_offsets[k];
+			good &= !use_status || status[k] == expect_status[k];
+		}
+		return good && (use_cps || cps[0] == 0xCCCC) && (use_offsets || offsets[0] == 0xCCCC) && (use_status || status[0] == 0xCC);
+	});
+
+	// a broken text against a changed copy of it, each compared and hashed as it is and as the lossy
+	// codepoints in another encoding
+	nerrors += random_group("compare and hash: across encodings", [](std::mt19937 &rng, int i) {
+		UTF_TYPE type = static_cast<UTF_TYPE>(i % 3);
+		UTF_BOM bom = i / 3 % 2 ? UTF_BE : UTF_LE;
+		const size_t ws = word_size(type);
+		auto a = random_text(rng, type, bom, i % 8 == 0 ? 2000 : rng() % 100, i % 3 == 0 ? 0 : 50);
+		auto b = a;
+		if(i % 4 == 0 && !b.empty()) b[rng() % b.size()] = static_cast<uint8_t>(rng());
+		if(i % 4 == 1) b.resize(b.size() / ws * (rng() % 100) / 100 * ws);
+		if(i % 4 == 2) {
+			auto more = random_text(rng, type, bom, rng() % 10, 0);
+			b.insert(b.end(), more.begin(), more.end());
+		}
+		if(rng() % 2) std::swap(a, b);
+
+		size_t replaced;
+		auto lossy = [&](const std::vector<uint8_t> &s) { return type == UTF8 ? whatwg_utf8(s, &replaced) : lossy_words(s, type, bom, &replaced); };
+		std::vector<char32_t> cps_a = lossy(a), cps_b = lossy(b);
+		int expect = cps_a < cps_b ? -1 : cps_b < cps_a ? 1 : 0;
+
+		UTF_TYPE other = static_cast<UTF_TYPE>(rng() % 3);
+		UTF_BOM other_bom = rng() % 2 ? UTF_BE : UTF_LE;
+		auto b2 = encode_all(cps_b, other, other_bom);
+		int got = utf_compare(a.data(), a.size() / ws, type, bom, b.data(), b.size() / ws, type, bom);
+		int got2 = utf_compare(b2.data(), b2.size() / word_size(other), other, other_bom, a.data(), a.size() / ws, type, bom);
+
+		uint64_t seed = rng();
+		uint64_t ha = utf_hash(a.data(), a.size() / ws, type, bom, seed), hb = utf_hash(b.data(), b.size() / ws, type, bom, seed);
+		uint64_t hb2 = utf_hash(b2.data(), b2.size() / word_size(other), other, other_bom, seed);
+		bool good = got == expect && got2 == -expect && hb == hb2 && (ha == hb) == (expect == 0);
+
+		// the value is part of the interface (it may be stored), the same from every implementation
+		if(i == 0) {
+			std::string fixed;
+			for(int k = 0; k < 100; k++) fixed += "a\xC3\xA9\xE7\x8C\xAB\xF0\x9F\x98\x80";
+			good &= utf_hash(fixed.data(), fixed.size(), UTF8, UTF_LE, 0) == 0xC8A0A0F4CF9E7B78ull;
+			good &= utf_hash(fixed.data(), fixed.size() - 3, UTF8, UTF_LE, 42) == 0x0A21E500F5816D7Dull;
+		}
+		return good;
+	});
+
+	// a run of ASCII, then two codepoints that may differ (the same byte when narrowed, or one of them
+	// ASCII), then more of both, in any two encodings
+	nerrors += random_group("compare: ASCII runs, then a difference", [](std::mt19937 &rng, int) {
+		static const char32_t picks[] = { 'a', 'b', 0x7F, 0xE9, 0xFF, 0x100, 0x1FF, 0x4E00, 0xD800, 0xDC00, 0x1F600, 0x10FFFF };
+		const size_t num_picks = sizeof(picks) / sizeof(picks[0]);
+		std::vector<char32_t> a;
+		for(size_t k = 0, n = rng() % 300; k < n; k++) a.push_back(0x20 + rng() % 0x5F);
+		std::vector<char32_t> b = a;
+		a.push_back(picks[rng() % num_picks]);
+		b.push_back(rng() % 2 ? a.back() : picks[rng() % num_picks]);
+		for(size_t k = 0, n = rng() % 100; k < n; k++) {
+			char32_t cp = rng() % 4 ? 0x20 + rng() % 0x5F : picks[rng() % num_picks];
+			a.push_back(cp);
+			b.push_back(cp);
+		}
+		if(rng() % 4 == 0) b.resize(rng() % (b.size() + 1));
+
+		UTF_TYPE ta = static_cast<UTF_TYPE>(rng() % 3), tb = static_cast<UTF_TYPE>(rng() % 3);
+		UTF_BOM ba = rng() % 2 ? UTF_BE : UTF_LE, bb = rng() % 2 ? UTF_BE : UTF_LE;
+		auto ea = encode_all(a, ta, ba), eb = encode_all(b, tb, bb);
+		size_t replaced;
+		auto lossy = [&](const std::vector<uint8_t> &s, UTF_TYPE type, UTF_BOM bom) { return type == UTF8 ? whatwg_utf8(s, &replaced) : lossy_words(s, type, bom, &replaced); };
+		std::vector<char32_t> la = lossy(ea, ta, ba), lb = lossy(eb, tb, bb);
+		int expect = la < lb ? -1 : lb < la ? 1 : 0;
+		return utf_compare(ea.data(), ea.size() / word_size(ta), ta, ba, eb.data(), eb.size() / word_size(tb), tb, bb) == expect
+			&& utf_compare(eb.data(), eb.size() / word_size(tb), tb, bb, ea.data(), ea.size() / word_size(ta), ta, ba) == -expect;
+	});
+
+	// a slice of the text's own codepoints (long ones past what's encoded up front), a changed one or a
+	// random one, against the first place a walk with the strict decoder has them all well-formed
+	nerrors += random_group("find: against a decoder walk", [](std::mt19937 &rng, int i) {
+		UTF_TYPE type = static_cast<UTF_TYPE>(i % 3);
+		UTF_BOM bom = i / 3 % 2 ? UTF_BE : UTF_LE;
+		auto src = random_text(rng, type, bom, i % 8 == 0 ? 3000 : rng() % 200, i % 4 == 0 ? 0 : 30);
+		std::vector<char32_t> cps;
+		std::vector<size_t> offsets;
+		std::vector<bool> ok;
+		for(size_t pos = 0; pos < src.size();) {
+			UTF_Cp c = next_cp(src.data() + pos, src.size() - pos, type, bom);
+			cps.push_back(c.codepoint);
+			offsets.push_back(pos);
+			ok.push_back(c.result == UTF_OK);
+			pos += c.num_words * word_size(type);
+		}
+
+		std::vector<char32_t> needle;
+		if(i % 5 < 3 && !cps.empty()) {
+			size_t at = rng() % cps.size(), n = i % 5 == 2 ? rng() % 60 : 1 + rng() % 4;
+			needle.assign(cps.begin() + at, cps.begin() + std::min(cps.size(), at + n));
+			if(i % 10 == 1 && !needle.empty()) needle[rng() % needle.size()] ^= 1 << rng() % 8;
+		}
+		else {
+			needle.resize(rng() % 3);
+			for(auto &c : needle) c = rng() % 2 ? U'a' + rng() % 4 : rng() % 0x110000;
+		}
+
+		bool valid = true;
+		for(char32_t c : needle) valid &= utf_is_valid_cp(c);
+		UTF_Found expect;
+		for(size_t k = 0; valid && !needle.empty() && k + needle.size() <= cps.size() && !expect.found; k++) {
+			bool same = true;
+			for(size_t j = 0; same && j < needle.size(); j++) same = ok[k + j] && cps[k + j] == needle[j];
+			if(same) expect.found = true, expect.byte = offsets[k], expect.codepoint = k;
+		}
+		if(valid && needle.empty()) expect.found = true;
+
+		size_t len = src.size() / word_size(type);
+		UTF_Found got = utf_find(src.data(), len, type, bom, needle.data(), needle.size());
+		bool good = got.found == expect.found && got.byte == expect.byte && got.codepoint == expect.codepoint;
+		if(needle.size() == 1) {
+			UTF_Found one = utf_find_codepoint(src.data(), len, type, bom, needle[0]);
+			good &= one.found == got.found && one.byte == got.byte && one.codepoint == got.codepoint;
+		}
+
+		// the needle's bytes across two words aren't it
+		if(i == 0) {
+			static const char16_t misaligned[] = { 0x4100, 0, 0x41 };
+			UTF_Found a = utf_find_codepoint(misaligned, 3, UTF16, UTF_LE, U'A');
+			good &= a.found && a.byte == 4 && a.codepoint == 2;
+		}
+		return good;
+	});
+
+	// runs of ASCII (controls in them too) between random text, against a walk with the strict decoder
+	nerrors += random_group("display width: against utf_cp_width", [](std::mt19937 &rng, int i) {
+		std::vector<uint8_t> src;
+		for(int k = 0, n = rng() % 8; k < n; k++) {
+			auto text = random_text(rng, UTF8, UTF_LE, rng() % 100, i % 3 == 0 ? 0 : 20);
+			src.insert(src.end(), text.begin(), text.end());
+			for(size_t run = rng() % (i % 2 ? 8 : 200); run > 0; run--) src.push_back(rng() % 8 ? 0x20 + rng() % 0x5F : rng() % 0x80);
+		}
+		size_t expect = 0;
+		for(size_t pos = 0; pos < src.size();) {
+			UTF_Cp c = next_cp(src.data() + pos, src.size() - pos, UTF8, UTF_LE);
+			expect += utf_cp_width(c.codepoint);
+			pos += c.num_words;
+		}
+		return utf8_display_width(src.data(), src.size()) == expect;
+	});
+
+	return nerrors;
+}
+
+// counters from a known workload on a few threads that have exited by the time they're read, and
+// the vector/scalar split of every implementation; all zero without UTF_ENABLE_STATS
+int stats_tests() {
+	LOG("\n\n[stats: counters from a known workload]");
+	static const char text[] = "a\xC3\xA9\xE7\x8C\xAB\xF0\x9F\x98\x80"; // aé猫😀
+	UTF_Stats before = utf_stats();
+
+	// 6 calls, 25 bytes, a 5-byte form and a surrogate (UTF_ILLEGAL_CODEPOINT), a lead byte with nothing
+	// after it and a step back from the start that decodes nothing; only the valid codepoints are counted
+	auto work = [] {
+		char16_t out[8];
+		utf8_to_utf16(text, 10, out, 8, UTF_LE);
+		utf8_decode("\xF8\x88\x80\x80\x80");
+		utf32LE_encode(0x10FFFF);
+		utf8_encode(0xD800);
+		utf8_validate("ab\xFF", 3);
+		utf8_decode_prev(text, 0);
+	};
+	for(int round = 0; round < 2; round++) {
+		std::vector<std::thread> threads;
+		for(int k = 0; k < 4; k++) threads.emplace_back(work);
+		for(auto &t : threads) t.join();
+	}
+
+	UTF_Stats st = utf_stats();
+	bool good = true;
+#ifdef UTF_ENABLE_STATS
+	const uint64_t n = 8, cps[5] = { 0, 3, 1, 1, 2 }, results[UTF_OUTPUT_FULL + 1] = { 3, 0, 1, 0, 2, 0 };
+	good &= st.calls - before.calls == 6 * n && st.bytes - before.bytes == 25 * n;
+	for(int k = 0; k < 5; k++) good &= st.codepoints[k] - before.codepoints[k] == cps[k] * n;
+	for(int k = 0; k <= UTF_OUTPUT_FULL; k++) good &= st.results[k] - before.results[k] == results[k] * n;
+	good &= st.simd_bytes + st.scalar_bytes - before.simd_bytes - before.scalar_bytes == 12 * n;
+
+	// whole vectors of ASCII are never taken one at a time
+	std::vector<char> ascii(1000, 'x');
+	for(UTF_IMPL impl : { UTF_IMPL_SCALAR, UTF_IMPL_SSE42, UTF_IMPL_AVX2, UTF_IMPL_AVX512 }) {
+		if(!utf_force_impl(impl)) continue;
+		UTF_Stats a = utf_stats();
+		utf8_validate(ascii.data(), ascii.size());
+		UTF_Stats b = utf_stats();
+		good &= b.simd_bytes + b.scalar_bytes - a.simd_bytes - a.scalar_bytes == ascii.size();
+		good &= impl == UTF_IMPL_SCALAR ? b.simd_bytes == a.simd_bytes : b.scalar_bytes - a.scalar_bytes < 64;
+	}
+	utf_force_impl(UTF_IMPL_AUTO);
+#else
+	good &= before.calls == 0 && st.calls == 0 && st.bytes == 0 && st.results[UTF_OK] == 0 && st.nanoseconds == 0;
+#endif
+
+	LOG("|  %s", good ? st_ok : st_fail);
+	return !good;
+}
+
 int utf_run_tests() {
 	int nerrors = 0;
 
@@ -199,6 +1433,31 @@ int utf_run_tests() {
 		}
 	}
 
+	nerrors += decode_cp_tests();
+	nerrors += literal_tests();
+	nerrors += parallel_tests();
+#ifdef __linux__
+	nerrors += file_tests();
+#endif
+	nerrors += view_tests();
+	nerrors += decode_prev_tests();
+	nerrors += stats_tests();
+	nerrors += props_tests();
+
+	for(UTF_IMPL impl : { UTF_IMPL_SCALAR, UTF_IMPL_SSE42, UTF_IMPL_AVX2, UTF_IMPL_AVX512 }) {
+		if(!utf_force_impl(impl)) {
+			LOG("\n\n=== bulk: %s not supported here ===", utf_impl_name(impl));
+			continue;
+		}
+		LOG("\n\n=== bulk: %s ===", utf_impl_name(impl));
+		nerrors += bulk_tests();
+	}
+
+	utf_force_impl(UTF_IMPL_AUTO);
+	bool auto_ok = utf_get_impl() == utf_best_impl() && utf_best_impl() != UTF_IMPL_AUTO;
+	LOG("\n\n[bulk: back to auto (%s)]\n|  %s", utf_impl_name(utf_get_impl()), auto_ok ? st_ok : st_fail);
+	if(!auto_ok) nerrors++;
+
 	if(nerrors)
 		LOG("\n== %i error(s) == ", nerrors);
 	else LOG("\n== no errors ==");
@@ -12,6 +12,22 @@ Full license is at the end of file.
 #define _UTF_H
 #include <stdint.h>
 #include <string.h>
+#include <stddef.h>
+#include <iterator>
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+#ifdef __cpp_lib_string_view
+#include <string_view>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+#ifdef __cpp_lib_ranges
+#include <ranges>
+#endif
 
 #define UTF_API extern "C"
 
@@ -31,7 +47,8 @@ enum UTF_RESULT {
 	UTF_UNEXPECTED_CONTINUATION,
 	UTF_TOO_FEW_WORDS,
 	UTF_OVERLONG,
-	UTF_ILLEGAL_CODEPOINT
+	UTF_ILLEGAL_CODEPOINT,
+	UTF_OUTPUT_FULL
 };
 
 
@@ -64,6 +81,31 @@ UTF_API inline UTF_Point utf_decode(const void *stream_beg, UTF_TYPE type, UTF_B
 }
 
 
+// the codepoint that ends at stream_beg + pos (pos in words), what the decoders above gave for it when
+// going forward, for moving a cursor back; nothing at or after pos is read, at pos 0 num_words is 0
+UTF_API UTF_Point utf8_decode_prev(const void *stream_beg, size_t pos);
+
+UTF_API UTF_Point utf16_decode_prev(const void *stream_beg, size_t pos, UTF_BOM en);
+UTF_API UTF_Point utf16BE_decode_prev(const void *stream_beg, size_t pos);
+UTF_API UTF_Point utf16LE_decode_prev(const void *stream_beg, size_t pos);
+
+UTF_API UTF_Point utf32_decode_prev(const void *stream_beg, size_t pos, UTF_BOM en);
+
+UTF_API inline UTF_Point utf_decode_prev(const void *stream_beg, size_t pos, UTF_TYPE type, UTF_BOM bom) {
+	switch(type) {
+		case UTF8: return utf8_decode_prev(stream_beg, pos);
+		case UTF16: return utf16_decode_prev(stream_beg, pos, bom);
+		case UTF32: return utf32_decode_prev(stream_beg, pos, bom);
+		default: return {};
+	}
+}
+
+// the last codepoint boundary at or before word n of a buffer of len words, where it can be cut
+// without splitting a sequence (n itself unless it's in the middle of one, len if n is past it)
+UTF_API size_t utf8_boundary(const void *stream_beg, size_t len, size_t n);
+UTF_API size_t utf16_boundary(const void *stream_beg, size_t len, size_t n, UTF_BOM en);
+
+
 UTF_API UTF_Point utf8_encode(char32_t codepoint);
 
 UTF_API UTF_Point utf16_encode(char32_t codepoint, UTF_BOM en);
@@ -84,241 +126,5386 @@ UTF_API inline UTF_Point utf_encode(char32_t codepoint, UTF_TYPE type, UTF_BOM b
 }
 
 
-UTF_API inline bool utf_is_valid_cp(char32_t codepoint) {
-	return codepoint <= 0x10FFFF && ((codepoint & 0xFC00) != 0xD800);
+UTF_API constexpr bool utf_is_valid_cp(char32_t codepoint) {
+	return codepoint <= 0x10FFFF && ((codepoint & 0xFFFFF800) != 0xD800);
 }
 
 
+// result of a whole-buffer operation, counts are in words of the respective encoding
+struct UTF_Bulk {
+	UTF_RESULT result{ UTF_OK };
+	size_t num_read = 0, num_written = 0;
+};
 
-#ifdef UTF_IMPLEMENTATION
 
-UTF_API UTF_Point utf8_decode(const void *s) {
-	const char *stream_beg = static_cast<const char *>(s);
-	UTF_Point ret;
-	UTF_Point *debug_pointer_cuz_vs_sucks = &ret;
-
-	switch(*stream_beg & 0xC0) {
-		case 0x00:
-		case 0x40:
-			// ascii
-			ret.num_words = 1;
-			ret.codepoint = static_cast<char32_t>(*stream_beg);
-			break;
-		case 0x80:
-			ret.result = UTF_UNEXPECTED_CONTINUATION;
-			ret.num_words = 1;
-			ret.codepoint = 0;
-			break;
-		default:
-		{
-			uint8_t expWords = 2;
-			for(; expWords < 7 && (*stream_beg << expWords) & 0x80; expWords++);
+// lean decoders for hot loops, same results as the ones returning UTF_Point but without the copy
+// of the bytes, the whole thing is 8 bytes and comes back in a register
+struct UTF_Cp {
+	char32_t codepoint = 0;
+	uint8_t num_words = 0, num_bytes = 0;
+	uint8_t result = UTF_OK; // UTF_RESULT
+};
 
-			ret.codepoint = *stream_beg & (0xff >> (expWords + 1));
 
-			for(ret.num_words = 1; ret.num_words < expWords; ret.num_words++) {
-				if(stream_beg[ret.num_words] == 0 || (stream_beg[ret.num_words] & 0xC0) != 0x80) {
-					ret.codepoint = 0;
-					ret.result = UTF_TOO_FEW_WORDS;
-					break;
-				}
-				ret.codepoint <<= 6;
-				ret.codepoint |= stream_beg[ret.num_words] & 0x3f;
-			}
+// the same codecs with the encoding and byte order as template parameters, everything is
+// constexpr and there are no runtime switches left for the compiler to see through
+// s can point to anything byte sized (uint8_t, char, a u8"" literal)
+namespace utf {
+
+constexpr size_t word_size(UTF_TYPE t) { return t == UTF8 ? 1 : t == UTF16 ? 2 : 4; }
+
+template<UTF_TYPE T, UTF_BOM B = UTF_LE> struct decoder;
+template<UTF_TYPE T, UTF_BOM B = UTF_LE> struct encoder;
+
+// decode() returns the lean UTF_Cp, point() the full UTF_Point like utf_decode
+// next(s, len) reads at most len bytes and is strict, an ill-formed sequence comes out as one U+FFFD
+// over its maximal subpart (as in the Unicode standard) with what's wrong with it in result
+// prev(s, pos, len) is the one next() gives that ends at s + pos (pos > 0 and on a sequence boundary)
+// decode_prev(s, pos) is what decode() gave for the sequence that ends at s + pos, for any pos decode()
+// gets to going forward (stepping num_bytes, errors included), nothing at or after s + pos is read
+template<class Codec, UTF_TYPE T, UTF_BOM B>
+struct decoder_base {
+	template<class Byte>
+	static constexpr UTF_Point point(const Byte *s) {
+		return to_point(Codec::decode(s), s);
+	}
+
+	// num_bytes is how far back it starts, 0 at pos 0
+	template<class Byte>
+	static constexpr UTF_Point point_prev(const Byte *s, size_t pos) {
+		UTF_Cp c = Codec::decode_prev(s, pos);
+		return to_point(c, s + pos - c.num_bytes);
+	}
 
-			if(ret.num_words == 1 || ret.result == UTF_TOO_FEW_WORDS) break;
+	template<class Byte>
+	static constexpr UTF_Point to_point(UTF_Cp c, const Byte *s) {
+		UTF_Point ret;
+		ret.codepoint = c.codepoint;
+		ret.type = T;
+		ret.bom = B;
+		ret.result = static_cast<UTF_RESULT>(c.result);
+		ret.num_words = c.num_words;
+		ret.num_bytes = c.num_bytes;
+		for(uint8_t i = 0; i < c.num_bytes; i++) ret.bytes[i] = static_cast<uint8_t>(s[i]);
+		return ret;
+	}
+};
 
-			// detect overlong
-			// idea: if you can fit the codepoint in one less word - then its overlong
-			
-			// total available bits for one less word
-			size_t n = ret.num_words - 1;
-			size_t avl_bits = n == 1 ? 7 : (6 * (n - 1) + (7 - n));
+template<UTF_BOM B>
+struct decoder<UTF8, B> : decoder_base<decoder<UTF8, B>, UTF8, B> {
+	template<class Byte>
+	static constexpr UTF_Cp decode(const Byte *s) {
+		UTF_Cp ret;
+		uint8_t lead = static_cast<uint8_t>(s[0]);
+		if(lead < 0x80) {
+			ret.codepoint = lead;
+			ret.num_words = ret.num_bytes = 1;
+			return ret;
+		}
+		if(lead < 0xC0) {
+			ret.result = UTF_UNEXPECTED_CONTINUATION;
+			ret.num_words = ret.num_bytes = 1;
+			return ret;
+		}
 
-			size_t overlong_mask = (~static_cast<size_t>(0)) << avl_bits;
-			if((ret.codepoint & overlong_mask) == 0) ret.result = UTF_OVERLONG;
+		uint8_t n = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+		for(; n < 7 && (lead << n) & 0x80; n++);
 
-			else if(!utf_is_valid_cp(ret.codepoint)) ret.result = UTF_ILLEGAL_CODEPOINT;
+		char32_t cp = lead & (0xFF >> (n + 1));
+		for(uint8_t i = 1; i < n; i++) {
+			uint8_t b = static_cast<uint8_t>(s[i]);
+			if((b & 0xC0) != 0x80) {
+				ret.result = UTF_TOO_FEW_WORDS;
+				ret.num_words = ret.num_bytes = i;
+				return ret;
+			}
+			cp = cp << 6 | (b & 0x3F);
 		}
+
+		ret.codepoint = cp;
+		ret.num_words = ret.num_bytes = n;
+		// would have fit in one word less
+		if((cp >> (n == 2 ? 7 : 5 * (n - 1) + 1)) == 0) ret.result = UTF_OVERLONG;
+		else if(!utf_is_valid_cp(cp)) ret.result = UTF_ILLEGAL_CODEPOINT;
+		return ret;
 	}
 
-	ret.num_bytes = ret.num_words;
-	memcpy(ret.bytes, stream_beg, ret.num_bytes);
+	template<class Byte>
+	static constexpr UTF_Cp next(const Byte *s, size_t len) {
+		UTF_Cp ret;
+		ret.num_words = ret.num_bytes = 1;
+		uint8_t lead = static_cast<uint8_t>(s[0]);
+		if(lead < 0x80) {
+			ret.codepoint = lead;
+			return ret;
+		}
+		ret.codepoint = 0xFFFD;
+		if(lead < 0xC0) ret.result = UTF_UNEXPECTED_CONTINUATION;
+		else if(lead < 0xC2) ret.result = UTF_OVERLONG;
+		else if(lead > 0xF4) ret.result = UTF_ILLEGAL_CODEPOINT;
+		if(ret.result != UTF_OK) return ret;
 
-	return ret;
-}
+		// the second byte has a narrower range after these
+		uint8_t lo = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+		uint8_t hi = lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF;
+		uint8_t b = len < 2 ? 0 : static_cast<uint8_t>(s[1]);
+		if(b < lo || b > hi) {
+			if((b & 0xC0) != 0x80) ret.result = UTF_TOO_FEW_WORDS;
+			else ret.result = lead == 0xE0 || lead == 0xF0 ? UTF_OVERLONG : UTF_ILLEGAL_CODEPOINT;
+			return ret;
+		}
+
+		uint8_t need = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4, n = 2;
+		char32_t cp = (lead & (0x7F >> need)) << 6 | (b & 0x3F);
+		for(; n < need && n < len && (static_cast<uint8_t>(s[n]) & 0xC0) == 0x80; n++)
+			cp = cp << 6 | (static_cast<uint8_t>(s[n]) & 0x3F);
+		ret.num_words = ret.num_bytes = n;
+		if(n < need) ret.result = UTF_TOO_FEW_WORDS;
+		else ret.codepoint = cp;
+		return ret;
+	}
 
+	template<class Byte>
+	static constexpr UTF_Cp prev(const Byte *s, size_t pos, size_t len) {
+		// everything but a continuation byte starts a sequence, and there are at most 3 of them
+		size_t l = pos - 1;
+		for(int k = 0; k < 3 && l > 0 && (static_cast<uint8_t>(s[l]) & 0xC0) == 0x80; k++) l--;
+		UTF_Cp c = next(s + l, len - l);
+		if(l + c.num_bytes == pos) return c;
+		// a stray continuation after it
+		return next(s + pos - 1, len - pos + 1);
+	}
 
-UTF_API UTF_Point utf16_decode(const void *s, UTF_BOM en) {
-	const uint8_t *stream_beg = static_cast<const uint8_t *>(s);
-	UTF_Point ret;
-	UTF_Point *debug_pointer_cuz_vs_sucks = &ret;
-	ret.type = UTF16;
-	ret.bom = en;
+	template<class Byte>
+	static constexpr UTF_Cp decode_prev(const Byte *s, size_t pos) {
+		if(pos == 0) return UTF_Cp{};
+		if(static_cast<uint8_t>(s[pos - 1]) < 0x80) return decode(s + pos - 1);
+		// decode() takes leads up to 0xFF, with 6 continuation bytes
+		size_t l = pos - 1;
+		for(int k = 0; k < 6 && l > 0 && (static_cast<uint8_t>(s[l]) & 0xC0) == 0x80; k++) l--;
+		uint8_t lead = static_cast<uint8_t>(s[l]);
+		if(lead >= 0x80 && lead < 0xC0) return decode(s + pos - 1);
 
-	wchar_t W[2];
-	bool is_be = en == UTF_BE;
-	for(int i = 0; i < 2; i++) {
-		W[i] = (static_cast<wchar_t>(stream_beg[i * 2 + !is_be]) << 8) | static_cast<wchar_t>(stream_beg[i * 2 + is_be]);
+		size_t n = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+		for(; n > 1 && n < 7 && (lead << n) & 0x80; n++);
+		// stray continuations after a whole sequence
+		if(n < pos - l) return decode(s + pos - 1);
+		if(n == pos - l) return decode(s + l);
+		// cut short, decode() stopped at pos
+		UTF_Cp ret;
+		ret.result = UTF_TOO_FEW_WORDS;
+		ret.num_words = ret.num_bytes = static_cast<uint8_t>(pos - l);
+		return ret;
 	}
+};
 
-	switch(W[0] & 0xfc00) {
-		case 0xdc00: // low surrogate (invalid)
-			ret.result = UTF_UNEXPECTED_CONTINUATION;
-			ret.num_words = 1;
-			break;
-		case 0xd800: // high surrogate
-			if((W[1] & 0xfc00) != 0xdc00) {
-				ret.result = UTF_TOO_FEW_WORDS;
-				ret.num_words = 1;
-			}
+template<UTF_BOM B>
+struct decoder<UTF16, B> : decoder_base<decoder<UTF16, B>, UTF16, B> {
+	template<class Byte>
+	static constexpr char32_t word(const Byte *s) {
+		return static_cast<char32_t>(static_cast<uint8_t>(s[B == UTF_LE])) << 8 | static_cast<uint8_t>(s[B != UTF_LE]);
+	}
+
+	template<class Byte>
+	static constexpr UTF_Cp decode(const Byte *s) {
+		UTF_Cp ret;
+		ret.num_words = 1;
+		ret.num_bytes = 2;
+
+		char32_t w = word(s);
+		if((w & 0xF800) != 0xD800) ret.codepoint = w;
+		else if(w >= 0xDC00) ret.result = UTF_UNEXPECTED_CONTINUATION;
+		else {
+			char32_t w2 = word(s + 2);
+			if((w2 & 0xFC00) != 0xDC00) ret.result = UTF_TOO_FEW_WORDS;
 			else {
+				ret.codepoint = ((w & 0x3FF) << 10) + (w2 & 0x3FF) + 0x10000;
 				ret.num_words = 2;
-				ret.codepoint = ((W[0] & 0x3ff) << 10) + (W[1] & 0x3ff) + 0x10000;
+				ret.num_bytes = 4;
 			}
-			break;
-		default:
-			ret.codepoint = static_cast<char32_t>(W[0]);
+		}
+		return ret;
+	}
+
+	template<class Byte>
+	static constexpr UTF_Cp next(const Byte *s, size_t len) {
+		UTF_Cp ret;
+		// a high surrogate at the very end
+		if(len < 4 && (word(s) & 0xFC00) == 0xD800) {
 			ret.num_words = 1;
+			ret.num_bytes = 2;
+			ret.result = UTF_TOO_FEW_WORDS;
+		}
+		else ret = decode(s);
+		if(ret.result != UTF_OK) ret.codepoint = 0xFFFD;
+		return ret;
+	}
+
+	template<class Byte>
+	static constexpr UTF_Cp prev(const Byte *s, size_t pos, size_t len) {
+		if(pos >= 4 && (word(s + pos - 2) & 0xFC00) == 0xDC00 && (word(s + pos - 4) & 0xFC00) == 0xD800)
+			return next(s + pos - 4, len - pos + 4);
+		return next(s + pos - 2, len - pos + 2);
+	}
+
+	template<class Byte>
+	static constexpr UTF_Cp decode_prev(const Byte *s, size_t pos) {
+		if(pos < 2) return UTF_Cp{};
+		char32_t w = word(s + pos - 2);
+		if((w & 0xFC00) == 0xDC00 && pos >= 4 && (word(s + pos - 4) & 0xFC00) == 0xD800) return decode(s + pos - 4);
+		if((w & 0xFC00) != 0xD800) return decode(s + pos - 2);
+		// a high surrogate right before pos wasn't followed by a low one
+		UTF_Cp ret;
+		ret.result = UTF_TOO_FEW_WORDS;
+		ret.num_words = 1;
+		ret.num_bytes = 2;
+		return ret;
+	}
+};
+
+template<UTF_BOM B>
+struct decoder<UTF32, B> : decoder_base<decoder<UTF32, B>, UTF32, B> {
+	template<class Byte>
+	static constexpr UTF_Cp decode(const Byte *s) {
+		UTF_Cp ret;
+		ret.num_words = 1;
+		ret.num_bytes = 4;
+		for(int i = 0; i < 4; i++)
+			ret.codepoint |= static_cast<char32_t>(static_cast<uint8_t>(s[B == UTF_BE ? 3 - i : i])) << i * 8;
+		if(!utf_is_valid_cp(ret.codepoint)) ret.result = UTF_ILLEGAL_CODEPOINT;
+		return ret;
+	}
+
+	template<class Byte>
+	static constexpr UTF_Cp next(const Byte *s, size_t) {
+		UTF_Cp ret = decode(s);
+		if(ret.result != UTF_OK) ret.codepoint = 0xFFFD;
+		return ret;
+	}
+
+	template<class Byte>
+	static constexpr UTF_Cp prev(const Byte *s, size_t pos, size_t len) {
+		return next(s + pos - 4, len - pos + 4);
+	}
+
+	template<class Byte>
+	static constexpr UTF_Cp decode_prev(const Byte *s, size_t pos) {
+		return pos < 4 ? UTF_Cp{} : decode(s + pos - 4);
+	}
+};
+
+// invalid codepoints are encoded anyway and reported with UTF_ILLEGAL_CODEPOINT, like utf_encode
+template<UTF_TYPE T, UTF_BOM B>
+struct encoder_base {
+	static constexpr UTF_Point point(char32_t codepoint) {
+		UTF_Point ret;
+		ret.codepoint = codepoint;
+		ret.type = T;
+		ret.bom = B;
+		ret.result = utf_is_valid_cp(codepoint) ? UTF_OK : UTF_ILLEGAL_CODEPOINT;
+		return ret;
+	}
+};
+
+template<UTF_BOM B>
+struct encoder<UTF8, B> : encoder_base<UTF8, B> {
+	static constexpr UTF_Point encode(char32_t codepoint) {
+		UTF_Point ret = encoder_base<UTF8, B>::point(codepoint);
+		uint8_t n = codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : codepoint < 0x200000 ? 4
+			: codepoint < 0x4000000 ? 5 : codepoint < 0x80000000 ? 6 : 7;
+		ret.num_words = ret.num_bytes = n;
+		if(n == 1) {
+			ret.bytes[0] = static_cast<uint8_t>(codepoint);
+			return ret;
+		}
+		for(uint8_t i = n - 1; i > 0; i--, codepoint >>= 6)
+			ret.bytes[i] = 0x80 | (codepoint & 0x3F);
+		ret.bytes[0] = static_cast<uint8_t>((0xFF00 >> n) | codepoint);
+		return ret;
+	}
+};
+
+template<UTF_BOM B>
+struct encoder<UTF16, B> : encoder_base<UTF16, B> {
+	static constexpr UTF_Point encode(char32_t codepoint) {
+		UTF_Point ret = encoder_base<UTF16, B>::point(codepoint);
+		uint16_t w[2]{ static_cast<uint16_t>(codepoint), 0 };
+		ret.num_words = 1;
+		if(codepoint >= 0x10000) {
+			ret.num_words = 2;
+			w[0] = static_cast<uint16_t>(0xD800 + ((codepoint - 0x10000) >> 10));
+			w[1] = static_cast<uint16_t>(0xDC00 + (codepoint & 0x3FF));
+		}
+		ret.num_bytes = ret.num_words * 2;
+		for(int i = 0; i < ret.num_words; i++) {
+			ret.bytes[i * 2 + (B == UTF_LE)] = static_cast<uint8_t>(w[i] >> 8);
+			ret.bytes[i * 2 + (B != UTF_LE)] = static_cast<uint8_t>(w[i]);
+		}
+		return ret;
 	}
+};
+
+template<UTF_BOM B>
+struct encoder<UTF32, B> : encoder_base<UTF32, B> {
+	static constexpr UTF_Point encode(char32_t codepoint) {
+		UTF_Point ret = encoder_base<UTF32, B>::point(codepoint);
+		ret.num_words = 1;
+		ret.num_bytes = 4;
+		for(int i = 0; i < 4; i++)
+			ret.bytes[B == UTF_BE ? 3 - i : i] = static_cast<uint8_t>(codepoint >> i * 8);
+		return ret;
+	}
+};
+
+// bytes of a string transcoded during compilation, zero terminated
+template<size_t Cap>
+struct transcoded {
+	uint8_t bytes[Cap]{ 0 };
+	UTF_Bulk status;
+};
 
-	ret.num_bytes = 2 * ret.num_words;
-	memcpy(ret.bytes, stream_beg, ret.num_bytes);
+// the input is a literal in native code units (u8"", u"", U""), it stops at the first error like
+// the bulk functions
+// constexpr auto hello = utf::transcode<UTF16, UTF_BE>(u8"Grüß Gott");
+template<UTF_TYPE To, UTF_BOM ToB = UTF_LE, class Unit, size_t N>
+constexpr transcoded<N * 4> transcode(const Unit (&src)[N]) {
+	constexpr UTF_TYPE from = sizeof(Unit) == 1 ? UTF8 : sizeof(Unit) == 2 ? UTF16 : UTF32;
 
+	// as little endian bytes, the zeros at the end stop the decoder
+	uint8_t in[N * sizeof(Unit) + 8]{ 0 };
+	for(size_t i = 0; i < N * sizeof(Unit); i++)
+		in[i] = static_cast<uint8_t>(static_cast<uint32_t>(src[i / sizeof(Unit)]) >> (i % sizeof(Unit) * 8));
+
+	transcoded<N * 4> ret;
+	size_t o = 0;
+	while(ret.status.num_read < N - 1) {
+		UTF_Cp c = decoder<from, UTF_LE>::decode(in + ret.status.num_read * sizeof(Unit));
+		if(c.result != UTF_OK) {
+			ret.status.result = static_cast<UTF_RESULT>(c.result);
+			break;
+		}
+		UTF_Point e = encoder<To, ToB>::encode(c.codepoint);
+		for(uint8_t i = 0; i < e.num_bytes; i++) ret.bytes[o++] = e.bytes[i];
+		ret.status.num_read += c.num_words;
+		ret.status.num_written += e.num_words;
+	}
 	return ret;
 }
 
-UTF_API UTF_Point utf16BE_decode(const void *s) {
-	return utf16_decode(s, UTF_BE);
-}
+// codepoints of a borrowed buffer, decoded one at a time as the iterator moves (either way), nothing is
+// allocated or copied, ill-formed sequences come out as U+FFFD the same as from utf_transcode_lossy
+// for(char32_t c : utf::codepoint_view<UTF16, UTF_BE>(buf, len_bytes))
+template<UTF_TYPE T, UTF_BOM B = UTF_LE>
+class codepoint_view {
+public:
+	class iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using iterator_concept = std::bidirectional_iterator_tag;
+		using value_type = char32_t;
+		using difference_type = ptrdiff_t;
+		using pointer = void;
+		using reference = char32_t;
 
-UTF_API UTF_Point utf16LE_decode(const void *s) {
-	return utf16_decode(s, UTF_LE);
-}
+		constexpr iterator() = default;
+		constexpr iterator(const uint8_t *buf, size_t at, size_t len_bytes) : s(buf), pos(at), len(len_bytes) { load(); }
 
+		constexpr char32_t operator*() const { return cur.codepoint; }
+		// the whole sequence, result says what's wrong with it if the codepoint is a replacement
+		constexpr UTF_Cp cp() const { return cur; }
+		// in bytes from the beginning of the buffer
+		constexpr size_t offset() const { return pos; }
 
-UTF_API UTF_Point utf32_decode(const void *s, UTF_BOM en) {
-	const uint8_t *stream_beg = static_cast<const uint8_t *>(s);
-	UTF_Point ret;
-	UTF_Point *debug_pointer_cuz_vs_sucks = &ret;
-	ret.type = UTF32;
-	ret.bom = en;
-	ret.num_words = 1;
-	ret.num_bytes = 4;
-	memcpy(ret.bytes, stream_beg, ret.num_bytes);
-	for(int i = 0; i < 4; i++)
-		ret.codepoint |= static_cast<char32_t>(stream_beg[en == UTF_BE ? 3 - i : i]) << i * 8;
-	ret.result = utf_is_valid_cp(ret.codepoint) ? UTF_OK : UTF_ILLEGAL_CODEPOINT;
-	return ret;
+		constexpr iterator &operator++() {
+			pos += cur.num_bytes;
+			load();
+			return *this;
+		}
+		constexpr iterator &operator--() {
+			cur = decoder<T, B>::prev(s, pos, len);
+			pos -= cur.num_bytes;
+			return *this;
+		}
+		constexpr iterator operator++(int) {
+			iterator ret = *this;
+			++*this;
+			return ret;
+		}
+		constexpr iterator operator--(int) {
+			iterator ret = *this;
+			--*this;
+			return ret;
+		}
+
+		constexpr bool operator==(const iterator &o) const { return pos == o.pos; }
+		constexpr bool operator!=(const iterator &o) const { return pos != o.pos; }
+
+	private:
+		constexpr void load() {
+			cur = pos < len ? decoder<T, B>::next(s + pos, len - pos) : UTF_Cp{};
+		}
+
+		const uint8_t *s = nullptr;
+		size_t pos = 0, len = 0;
+		UTF_Cp cur;
+	};
+
+	constexpr codepoint_view() = default;
+	// a word cut off at the end is left out
+	codepoint_view(const void *buf, size_t len_bytes)
+		: s(static_cast<const uint8_t *>(buf)), len(len_bytes / word_size(T) * word_size(T)) {}
+#ifdef __cpp_lib_string_view
+	template<class C>
+	codepoint_view(std::basic_string_view<C> str) : codepoint_view(str.data(), str.size() * sizeof(C)) {}
+#endif
+#ifdef __cpp_lib_span
+	template<class U, size_t E>
+	codepoint_view(std::span<U, E> buf) : codepoint_view(buf.data(), buf.size_bytes()) {}
+#endif
+
+	constexpr iterator begin() const { return iterator(s, 0, len); }
+	constexpr iterator end() const { return iterator(s, len, len); }
+	constexpr bool empty() const { return len == 0; }
+	// of the buffer, not codepoints
+	constexpr size_t size_bytes() const { return len; }
+
+private:
+	const uint8_t *s = nullptr;
+	size_t len = 0;
+};
+
+} // namespace utf
+
+#ifdef __cpp_lib_ranges
+// the view doesn't own the buffer, iterators stay good after it's gone
+namespace std {
+namespace ranges {
+template<UTF_TYPE T, UTF_BOM B>
+inline constexpr bool enable_borrowed_range<utf::codepoint_view<T, B>> = true;
+template<UTF_TYPE T, UTF_BOM B>
+inline constexpr bool enable_view<utf::codepoint_view<T, B>> = true;
+} // namespace ranges
+} // namespace std
+#endif
+
+
+UTF_API inline UTF_Cp utf8_decode_cp(const void *stream_beg) {
+	return utf::decoder<UTF8>::decode(static_cast<const uint8_t *>(stream_beg));
 }
 
-UTF_API UTF_Point utf32BE_decode(const void *s) {
-	return utf32_decode(s, UTF_BE);
+UTF_API inline UTF_Cp utf16_decode_cp(const void *stream_beg, UTF_BOM en) {
+	const uint8_t *s = static_cast<const uint8_t *>(stream_beg);
+	return en == UTF_BE ? utf::decoder<UTF16, UTF_BE>::decode(s) : utf::decoder<UTF16, UTF_LE>::decode(s);
 }
 
-UTF_API UTF_Point utf32LE_decode(const void *s) {
-	return utf32_decode(s, UTF_LE);
+UTF_API inline UTF_Cp utf32_decode_cp(const void *stream_beg, UTF_BOM en) {
+	const uint8_t *s = static_cast<const uint8_t *>(stream_beg);
+	return en == UTF_BE ? utf::decoder<UTF32, UTF_BE>::decode(s) : utf::decoder<UTF32, UTF_LE>::decode(s);
+}
+
+UTF_API inline UTF_Cp utf_decode_cp(const void *stream_beg, UTF_TYPE type, UTF_BOM bom) {
+	switch(type) {
+		case UTF8: return utf8_decode_cp(stream_beg);
+		case UTF16: return utf16_decode_cp(stream_beg, bom);
+		case UTF32: return utf32_decode_cp(stream_beg, bom);
+		default: return {};
+	}
 }
 
 
+// on error num_read is the offset of the first invalid sequence
+UTF_API UTF_Bulk utf8_validate(const void *stream_beg, size_t len);
 
-UTF_API UTF_Point utf8_encode(char32_t codepoint) {
-	UTF_Point ret;
-	ret.codepoint = codepoint;
-	ret.result = utf_is_valid_cp(codepoint) ? UTF_OK : UTF_ILLEGAL_CODEPOINT;
+// transcoders stop at the first invalid sequence (num_read is its offset)
+// or with UTF_OUTPUT_FULL before a codepoint that doesn't fit in cap words, never in the middle of one,
+// so a fixed-size dst can be flushed and the call repeated from src + num_read; only the input cap words
+// can take is looked at. nothing here allocates, words of dst past num_written may have been written to
+UTF_API UTF_Bulk utf8_to_utf16(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en);
+UTF_API UTF_Bulk utf16_to_utf8(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en);
+UTF_API UTF_Bulk utf8_to_utf32(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en);
+// invalid codepoints (see utf_is_valid_cp) stop it with UTF_ILLEGAL_CODEPOINT
+UTF_API UTF_Bulk utf32_to_utf8(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en);
 
-	if(codepoint < 0x80) {
-		ret.num_bytes = ret.num_words = 1;
-		ret.bytes[0] = static_cast<char>(codepoint);
-		return ret;
-	}
+// UTF-16 / UTF-32 into the other byte order, en is the one src is in; src and dst can be the same buffer
+// with validate it stops like the transcoders at the first unpaired surrogate or word that fails
+// utf_is_valid_cp (and before a pair that doesn't fit), without it every word is swapped as it is
+UTF_API UTF_Bulk utf16_swap(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en, bool validate);
+UTF_API UTF_Bulk utf32_swap(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en, bool validate);
 
-	uint8_t words[8]{ 0 };
-	uint8_t num_words = 0;
-	uint8_t word_val = 0;
-	char32_t header_bits = 0x1f;
+// output sizes in words for pre-allocation, nothing is written
+// exact for valid input, otherwise at least what the transcoder writes before it stops
+UTF_API size_t utf8_count_codepoints(const void *src, size_t len);
+UTF_API size_t utf16_length_from_utf8(const void *src, size_t len);
+UTF_API size_t utf8_length_from_utf16(const void *src, size_t len, UTF_BOM en);
+UTF_API size_t utf8_length_from_utf32(const void *src, size_t len, UTF_BOM en);
 
-	for(;;) {
-		word_val = codepoint & 0x3f;
-		codepoint >>= 6;
-		words[7 - num_words] = word_val | 0x80;
-		num_words++;
-
-		if((codepoint & ~header_bits) == 0) {
-			word_val = static_cast<uint8_t>(0xff << (7 - num_words)) | (codepoint & header_bits);
-			words[7 - num_words] = word_val;
-			num_words++;
-			break;
-		}
+// ASCII and Latin-1 (ISO-8859-1, every byte is the codepoint of the same value, U+0000 - U+00FF)
+// the first byte over 0x7F is UTF_ILLEGAL_CODEPOINT at num_read
+UTF_API UTF_Bulk ascii_validate(const void *src, size_t len);
+// every byte is valid, the only stop is UTF_OUTPUT_FULL
+UTF_API UTF_Bulk latin1_to_utf8(const void *src, size_t len, void *dst, size_t cap);
+UTF_API UTF_Bulk latin1_to_utf16(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en);
+// stops like the transcoders above, a codepoint over U+00FF with UTF_ILLEGAL_CODEPOINT
+UTF_API UTF_Bulk utf8_to_latin1(const void *src, size_t len, void *dst, size_t cap);
+// exact, utf8_count_codepoints is the size the other way
+UTF_API size_t utf8_length_from_latin1(const void *src, size_t len);
+
+// any encoding to any other, uses the functions above where there is one
+UTF_API UTF_Bulk utf_transcode(const void *src, size_t len, UTF_TYPE from, UTF_BOM from_bom, void *dst, size_t cap, UTF_TYPE to, UTF_BOM to_bom);
+// what utf_transcode_lossy replaced, one count per U+FFFD under the error it stands for (count[UTF_OVERLONG], ...)
+struct UTF_Errors {
+	size_t count[UTF_OUTPUT_FULL]{ 0 };
+};
+
+// never stops at invalid input, every maximal ill-formed subpart (as in the Unicode standard and WHATWG)
+// becomes one U+FFFD, the only results are UTF_OK and UTF_OUTPUT_FULL
+// errors (may be null) is added to, clean input costs the same as utf_transcode
+UTF_API UTF_Bulk utf_transcode_lossy(const void *src, size_t len, UTF_TYPE from, UTF_BOM from_bom, void *dst, size_t cap, UTF_TYPE to, UTF_BOM to_bom, UTF_Errors *errors);
+
+// decodes into columns, entry k is codepoint cps[k] starting offsets[k] bytes into src with UTF_RESULT status[k]
+// any of the three may be null when it isn't needed, cap is the number of entries they have room for
+// invalid input is decoded like utf_transcode_lossy, an entry of U+FFFD per maximal subpart with what's wrong
+// with it in status, so the only results are UTF_OK and UTF_OUTPUT_FULL (also when offsets would pass 4 GiB)
+UTF_API UTF_Bulk utf_decode_columns(const void *src, size_t len, UTF_TYPE type, UTF_BOM bom, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap);
+
+// texts in any two encodings by their codepoints, <0, 0 or >0 like memcmp, nothing is allocated
+// ill-formed subparts are U+FFFD like in utf_transcode_lossy, so texts that only differ in how they're broken are equal
+UTF_API int utf_compare(const void *a, size_t len_a, UTF_TYPE type_a, UTF_BOM bom_a, const void *b, size_t len_b, UTF_TYPE type_b, UTF_BOM bom_b);
+// 64-bit hash of the codepoints, the same for the same text in any encoding (and for texts utf_compare finds equal)
+UTF_API uint64_t utf_hash(const void *src, size_t len, UTF_TYPE type, UTF_BOM bom, uint64_t seed);
+
+#ifndef UTF_PARALLEL_MIN
+#define UTF_PARALLEL_MIN (1 << 20)
+#endif
+// the same split over num_threads threads (0 - one per core), each writes its part straight into dst
+// inputs under UTF_PARALLEL_MIN bytes per thread are done on the calling thread
+UTF_API UTF_Bulk utf_transcode_parallel(const void *src, size_t len, UTF_TYPE from, UTF_BOM from_bom, void *dst, size_t cap, UTF_TYPE to, UTF_BOM to_bom, unsigned num_threads);
+
+
+// transcoder for input that arrives in pieces of any size (even split words), a sequence cut off
+// at the end of a piece is kept in the stream (at most 3 bytes of valid text) until the next one
+struct UTF_Stream {
+	UTF_TYPE from{ UTF8 }, to{ UTF8 };
+	UTF_BOM from_bom{ UTF_LE }, to_bom{ UTF_LE };
+	UTF_RESULT result{ UTF_OK };
+	uint8_t num_pending = 0;
+	uint8_t pending[8]{ 0 };
+};
+
+UTF_API UTF_Stream utf_stream(UTF_TYPE from, UTF_BOM from_bom, UTF_TYPE to, UTF_BOM to_bom);
+// num_read is in bytes of chunk, num_written in words of the output
+// with UTF_OUTPUT_FULL call again with the rest of chunk, an error is sticky and num_read is where
+// the invalid sequence starts (0 if it started in an earlier chunk)
+UTF_API UTF_Bulk utf_stream_write(UTF_Stream *st, const void *chunk, size_t len, void *dst, size_t cap);
+// end of input, a sequence still pending is UTF_TOO_FEW_WORDS
+UTF_API UTF_RESULT utf_stream_end(UTF_Stream *st);
+
+
+#ifdef __linux__
+#ifndef UTF_FILE_BATCH
+#define UTF_FILE_BATCH (1 << 20)
+#endif
+// num_read and num_written are in words from where in and out were, error is the errno of a call that failed
+struct UTF_FileBulk {
+	UTF_RESULT result{ UTF_OK };
+	uint64_t num_read = 0, num_written = 0;
+	int error = 0;
+};
+
+// whole files on Linux, stops like utf_transcode with what came before the error written
+// a regular file in is mapped, never copied, anything else is read() through a UTF_Stream
+// a regular file out, open for reading and writing and at offset 0, is sized by a counting pass over the
+// mapped input, mapped and filled by utf_transcode_parallel, then cut to what was written; anything else
+// (a pipe, O_WRONLY, O_APPEND) gets write()s of UTF_FILE_BATCH bytes, one written while the next is transcoded
+UTF_API UTF_FileBulk utf_transcode_fd(int in, UTF_TYPE from, UTF_BOM from_bom, int out, UTF_TYPE to, UTF_BOM to_bom);
+// creates or truncates dst_path
+UTF_API UTF_FileBulk utf_transcode_file(const char *src_path, UTF_TYPE from, UTF_BOM from_bom, const char *dst_path, UTF_TYPE to, UTF_BOM to_bom);
+#endif
+
+
+// where every step-th codepoint of a text starts, in bytes and in UTF-16 units
+struct UTF_IndexEntry {
+	uint64_t byte = 0, unit16 = 0;
+};
+
+// side index for random access into UTF-8 text by codepoint, byte or UTF-16 unit offset, entries[i] is
+// codepoint i * step; the entries are the caller's and plain data, with the totals they can be kept (in a
+// file even) and used again with the same text. an ill-formed subpart counts as one codepoint, like U+FFFD
+struct UTF_Index {
+	UTF_IndexEntry *entries = nullptr;
+	size_t cap = 0, num_entries = 0;
+	uint32_t step = 256;
+	// how much of the text is indexed
+	uint64_t num_codepoints = 0, num_bytes = 0, num_units16 = 0;
+};
+
+enum UTF_UNIT {
+	UTF_UNIT_CODEPOINT,
+	UTF_UNIT_BYTE,
+	UTF_UNIT_UTF16
+};
+
+// one position in all three units
+struct UTF_Offset {
+	uint64_t codepoint = 0, byte = 0, unit16 = 0;
+};
+
+// step 0 - 256, entries is room for cap of them
+UTF_API UTF_Index utf_index(UTF_IndexEntry *entries, size_t cap, uint32_t step);
+// entries that len bytes of text need at most
+UTF_API size_t utf_index_capacity(size_t len, uint32_t step);
+// indexes text from num_bytes to len, text is all of it so far (what was indexed before, unchanged, and
+// what's been appended since), a sequence cut off at the end waits for the next call
+// UTF_OUTPUT_FULL if the entries ran out, the index is good up to num_bytes and goes on from there once
+// entries and cap point to more room (with the old entries copied over)
+UTF_API UTF_RESULT utf_index_update(UTF_Index *ix, const void *text, size_t len);
+// the codepoint at offset at in unit (or the one it's in the middle of), the end of the indexed text
+// if at is past it
+UTF_API UTF_Offset utf_index_find(const UTF_Index *ix, const void *text, UTF_UNIT unit, uint64_t at);
+
+
+// what unlabelled text most likely is, from utf_detect
+struct UTF_Detected {
+	UTF_TYPE type{ UTF8 };
+	UTF_BOM bom{ UTF_LE };
+	// length of the byte order mark the text starts with (0 without one), to skip before decoding
+	uint8_t bom_bytes = 0;
+	// 0 - 100, 100 with a byte order mark, 0 for empty or binary input
+	uint8_t confidence = 0;
+};
+
+#ifndef UTF_DETECT_SAMPLE
+#define UTF_DETECT_SAMPLE 4096
+#endif
+// a byte order mark if there is one, otherwise a guess from the first UTF_DETECT_SAMPLE bytes: where the
+// zero and control bytes are, how much of it is valid in each encoding and how few values the high bytes
+// of UTF-16 take next to the low ones, nothing past the sample is read
+UTF_API UTF_Detected utf_detect(const void *text, size_t len);
+
+// where utf_find found it, in bytes and in codepoints before it (an ill-formed subpart counting as one)
+struct UTF_Found {
+	bool found = false;
+	uint64_t byte = 0, codepoint = 0;
+};
+
+// the first place the needle's codepoints are in text of len words, it's encoded once and the text
+// searched as it is, vectors at a time for its first and last byte; a match starts at a word boundary
+// and the needle's first word can't continue a sequence, so it never starts inside one
+// an empty needle is found at 0, one with a codepoint that fails utf_is_valid_cp nowhere
+UTF_API UTF_Found utf_find(const void *text, size_t len, UTF_TYPE type, UTF_BOM bom, const char32_t *needle, size_t needle_len);
+UTF_API UTF_Found utf_find_codepoint(const void *text, size_t len, UTF_TYPE type, UTF_BOM bom, char32_t cp);
+
+// the General_Category of a codepoint, Cn for the unassigned ones
+enum UTF_CATEGORY {
+	UTF_CAT_Cn,
+	UTF_CAT_Lu, UTF_CAT_Ll, UTF_CAT_Lt, UTF_CAT_Lm, UTF_CAT_Lo,
+	UTF_CAT_Mn, UTF_CAT_Mc, UTF_CAT_Me,
+	UTF_CAT_Nd, UTF_CAT_Nl, UTF_CAT_No,
+	UTF_CAT_Pc, UTF_CAT_Pd, UTF_CAT_Ps, UTF_CAT_Pe, UTF_CAT_Pi, UTF_CAT_Pf, UTF_CAT_Po,
+	UTF_CAT_Sm, UTF_CAT_Sc, UTF_CAT_Sk, UTF_CAT_So,
+	UTF_CAT_Zs, UTF_CAT_Zl, UTF_CAT_Zp,
+	UTF_CAT_Cc, UTF_CAT_Cf, UTF_CAT_Cs, UTF_CAT_Co,
+};
+
+// properties from the Unicode Character Database (ucd_props.txt, turned into tables by gen_tables.cpp),
+// each a lookup in three small tables; a codepoint over U+10FFFF is taken as U+FFFD
+// columns it takes in a terminal: 0 for marks, format and control characters and the Hangul vowels
+// and final consonants that join a syllable, 2 for East Asian wide and fullwidth ones, else 1
+UTF_API int utf_cp_width(char32_t cp);
+UTF_API UTF_CATEGORY utf_cp_category(char32_t cp);
+// the columns of UTF-8 text, an ill-formed subpart is a U+FFFD (1), runs of ASCII are counted vectors
+// at a time without the tables
+UTF_API size_t utf8_display_width(const void *src, size_t len);
+
+// implementations of the bulk functions, the best one the CPU supports is picked on first use
+enum UTF_IMPL {
+	UTF_IMPL_AUTO,
+	UTF_IMPL_SCALAR,
+	UTF_IMPL_SSE42,
+	UTF_IMPL_AVX2,
+	UTF_IMPL_AVX512,
+};
 
-		header_bits >>= 1;
+UTF_API UTF_IMPL utf_get_impl();
+UTF_API UTF_IMPL utf_best_impl();
+// false if the CPU or the build doesn't support impl, UTF_IMPL_AUTO goes back to the best one
+UTF_API bool utf_force_impl(UTF_IMPL impl);
+UTF_API const char *utf_impl_name(UTF_IMPL impl);
+
+
+// counters kept with UTF_ENABLE_STATS defined where the implementation is compiled (all zero without it)
+// by the bulk functions, utf_transcode and the UTF_Point decoders and encoders; the lean and template
+// decoders, the length functions, utf_index and utf_detect aren't counted
+// every thread adds to its own counters, they only go up, so subtract two snapshots for an interval
+struct UTF_Stats {
+	uint64_t calls = 0;
+	// input bytes taken, the valid part for a bulk function that stopped at an error
+	uint64_t bytes = 0;
+	// the valid ones by the length of their UTF-8 form, [0] is unused; errors are only in results
+	uint64_t codepoints[5]{ 0 };
+	uint64_t results[UTF_OUTPUT_FULL + 1]{ 0 };
+	// input bytes of the bulk functions taken in vectors and one codepoint at a time, all of them
+	// scalar_bytes with UTF_IMPL_SCALAR
+	uint64_t simd_bytes = 0, scalar_bytes = 0;
+	// spent in the bulk functions
+	uint64_t nanoseconds = 0;
+};
+
+// the sum over every thread that ever called in, threads that have exited included
+UTF_API UTF_Stats utf_stats();
+
+
+
+#ifdef UTF_IMPLEMENTATION
+
+// stats
+
+#ifdef UTF_ENABLE_STATS
+#include <atomic>
+#include <chrono>
+
+namespace utf_detail {
+
+enum { STAT_LATIN1 = 3 };
+
+enum {
+	STAT_CALLS,
+	STAT_BYTES,
+	STAT_CODEPOINTS,
+	STAT_RESULTS = STAT_CODEPOINTS + 5,
+	STAT_SIMD = STAT_RESULTS + UTF_OUTPUT_FULL + 1,
+	STAT_SCALAR,
+	STAT_NS,
+	STAT_COUNT
+};
+
+// one per thread, only ever written by the thread holding it and never freed, so a reader can walk
+// the list at any time; the block of a thread that exited goes to the next new one, counts and all
+struct stats_block {
+	std::atomic<uint64_t> v[STAT_COUNT];
+	std::atomic<bool> used;
+	stats_block *next;
+};
+
+static std::atomic<stats_block *> stats_head{ nullptr };
+
+static stats_block *stats_claim() {
+	for(stats_block *b = stats_head.load(std::memory_order_acquire); b; b = b->next) {
+		bool free = false;
+		if(!b->used.load(std::memory_order_relaxed) && b->used.compare_exchange_strong(free, true, std::memory_order_acquire)) return b;
 	}
+	stats_block *b = new stats_block();
+	b->used.store(true, std::memory_order_relaxed);
+	b->next = stats_head.load(std::memory_order_relaxed);
+	while(!stats_head.compare_exchange_weak(b->next, b, std::memory_order_release, std::memory_order_relaxed));
+	return b;
+}
 
-	ret.num_bytes = ret.num_words = num_words;
-	memcpy(ret.bytes, words + 8 - ret.num_bytes, ret.num_bytes);
+struct stats_owner {
+	stats_block *b = stats_claim();
+	~stats_owner() { b->used.store(false, std::memory_order_release); }
+};
 
-	return ret;
+static inline stats_block &stats_local() {
+	static thread_local stats_owner owner;
+	return *owner.b;
 }
 
+// no other writer, a plain add is enough
+static inline void stat_add(stats_block &b, int k, uint64_t n) {
+	b.v[k].store(b.v[k].load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
 
-UTF_API UTF_Point utf16_encode(char32_t codepoint, UTF_BOM en) {
-	UTF_Point ret;
-	UTF_Point *debug_pointer_cuz_vs_sucks = &ret;
-	ret.codepoint = codepoint;
-	ret.type = UTF16;
-	ret.bom = en;
-	ret.result = utf_is_valid_cp(codepoint) ? UTF_OK : UTF_ILLEGAL_CODEPOINT;
-
-	wchar_t W[2];
-	if(codepoint < 0x10000) {
-		ret.num_words = 1;
-		W[0] = codepoint & 0xffff;
+// input bytes a vector kernel took one codepoint at a time, collected by stat_bulk
+static thread_local uint64_t stat_scalar_bytes = 0;
+
+static inline int utf8_length_of(char32_t cp) {
+	return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : cp < 0x200000 ? 4 : cp < 0x4000000 ? 5 : cp < 0x80000000 ? 6 : 7;
+}
+
+static inline UTF_Point stat_point(const UTF_Point &p, bool decode) {
+	stats_block &b = stats_local();
+	stat_add(b, STAT_CALLS, 1);
+	stat_add(b, STAT_BYTES, decode ? p.num_bytes : 4);
+	// utf*_decode_prev at 0 decodes nothing
+	if(p.result == UTF_OK && p.num_words) stat_add(b, STAT_CODEPOINTS + (decode && p.type == UTF8 ? p.num_words : utf8_length_of(p.codepoint)), 1);
+	stat_add(b, STAT_RESULTS + static_cast<int>(p.result), 1);
+	return p;
+}
+
+// text is a UTF_TYPE or STAT_LATIN1; the input is valid up to len words
+static inline void stat_codepoints(stats_block &b, const uint8_t *s, size_t len, int text, UTF_BOM en) {
+	uint64_t c[5] = { 0 };
+	if(text == UTF8) {
+		for(size_t i = 0; i < len; i++)
+			if((s[i] & 0xC0) != 0x80) c[s[i] < 0x80 ? 1 : s[i] < 0xE0 ? 2 : s[i] < 0xF0 ? 3 : 4]++;
 	}
-	else {
-		ret.num_words = 2;
-		codepoint -= 0x10000;
-		W[0] = 0xD800 + (codepoint >> 10);
-		W[1] = 0xDC00 + (codepoint & 0x3ff);
+	else if(text == UTF16) {
+		for(size_t i = 0; i < len; i++) {
+			uint16_t w = static_cast<uint16_t>(en == UTF_BE ? s[i * 2] << 8 | s[i * 2 + 1] : s[i * 2 + 1] << 8 | s[i * 2]);
+			if((w & 0xFC00) != 0xDC00) c[(w & 0xFC00) == 0xD800 ? 4 : utf8_length_of(w)]++;
+		}
 	}
-
-	ret.num_bytes = ret.num_words * 2;
-	for(int i = 0; i < 2; i++) {
-		uint8_t hibyte = W[i] >> 8, lobyte = W[i] & 0xff;
-		ret.bytes[i * 2] = (en == UTF_BE) ? hibyte : lobyte;
-		ret.bytes[i * 2 + 1] = (en == UTF_BE) ? lobyte : hibyte;
+	else if(text == UTF32) {
+		for(size_t i = 0; i < len; i++) {
+			const uint8_t *p = s + i * 4;
+			char32_t cp = en == UTF_BE ? char32_t(p[0]) << 24 | p[1] << 16 | p[2] << 8 | p[3] : char32_t(p[3]) << 24 | p[2] << 16 | p[1] << 8 | p[0];
+			c[cp < 0x10000 ? utf8_length_of(cp) : 4]++;
+		}
 	}
+	else for(size_t i = 0; i < len; i++) c[1 + (s[i] >> 7)]++;
+	for(int k = 1; k < 5; k++) stat_add(b, STAT_CODEPOINTS + k, c[k]);
+}
+
+template<class F>
+static inline UTF_Bulk stat_bulk(const void *src, int text, UTF_BOM en, bool simd, F f) {
+	const uint64_t scalar0 = stat_scalar_bytes;
+	const auto t0 = std::chrono::steady_clock::now();
+	UTF_Bulk ret = f();
+	const auto t1 = std::chrono::steady_clock::now();
+
+	stats_block &b = stats_local();
+	uint64_t bytes = ret.num_read * (text == UTF16 ? 2 : text == UTF32 ? 4 : 1);
+	uint64_t scalar = simd ? stat_scalar_bytes - scalar0 : bytes;
+	if(scalar > bytes) scalar = bytes;
+	stat_add(b, STAT_CALLS, 1);
+	stat_add(b, STAT_BYTES, bytes);
+	stat_codepoints(b, static_cast<const uint8_t *>(src), ret.num_read, text, en);
+	stat_add(b, STAT_RESULTS + static_cast<int>(ret.result), 1);
+	stat_add(b, STAT_SIMD, bytes - scalar);
+	stat_add(b, STAT_SCALAR, scalar);
+	stat_add(b, STAT_NS, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()));
 	return ret;
 }
 
-UTF_API UTF_Point utf16BE_encode(char32_t codepoint) {
-	return utf16_encode(codepoint, UTF_BE);
+} // namespace utf_detail
+
+#define UTF_STAT_POINT(decode, ...) utf_detail::stat_point(__VA_ARGS__, decode)
+#define UTF_STAT_BULK(src, text, en, ...) utf_detail::stat_bulk(src, text, en, utf_detail::kernels()->impl != UTF_IMPL_SCALAR, [&] { return __VA_ARGS__; })
+#define UTF_STAT_SCALAR(n) (utf_detail::stat_scalar_bytes += (n))
+#else
+#define UTF_STAT_POINT(decode, ...) (__VA_ARGS__)
+#define UTF_STAT_BULK(src, text, en, ...) (__VA_ARGS__)
+#define UTF_STAT_SCALAR(n) ((void)sizeof(n))
+#endif
+
+UTF_API UTF_Stats utf_stats() {
+	UTF_Stats st;
+#ifdef UTF_ENABLE_STATS
+	uint64_t v[utf_detail::STAT_COUNT] = { 0 };
+	for(utf_detail::stats_block *b = utf_detail::stats_head.load(std::memory_order_acquire); b; b = b->next)
+		for(int k = 0; k < utf_detail::STAT_COUNT; k++) v[k] += b->v[k].load(std::memory_order_relaxed);
+	st.calls = v[utf_detail::STAT_CALLS];
+	st.bytes = v[utf_detail::STAT_BYTES];
+	for(int k = 0; k < 5; k++) st.codepoints[k] = v[utf_detail::STAT_CODEPOINTS + k];
+	for(int k = 0; k <= UTF_OUTPUT_FULL; k++) st.results[k] = v[utf_detail::STAT_RESULTS + k];
+	st.simd_bytes = v[utf_detail::STAT_SIMD];
+	st.scalar_bytes = v[utf_detail::STAT_SCALAR];
+	st.nanoseconds = v[utf_detail::STAT_NS];
+#endif
+	return st;
 }
 
-UTF_API UTF_Point utf16LE_encode(char32_t codepoint) {
-	return utf16_encode(codepoint, UTF_LE);
+
+UTF_API UTF_Point utf8_decode(const void *s) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF8>::point(static_cast<const uint8_t *>(s)));
 }
 
 
-UTF_API UTF_Point utf32_encode(char32_t codepoint, UTF_BOM en) {
-	UTF_Point ret;
-	UTF_Point *debug_pointer_cuz_vs_sucks = &ret;
-	ret.codepoint = codepoint;
-	ret.type = UTF32;
-	ret.bom = en;
-	ret.num_words = 1;
-	ret.num_bytes = 4;
-	ret.result = utf_is_valid_cp(codepoint) ? UTF_OK : UTF_ILLEGAL_CODEPOINT;
-	for(int i = 0; i < 4; i++)
-		ret.bytes[en == UTF_BE ? 3 - i : i] = static_cast<uint8_t>(codepoint >> i * 8);
-	return ret;
+UTF_API UTF_Point utf16_decode(const void *s, UTF_BOM en) {
+	return en == UTF_BE ? utf16BE_decode(s) : utf16LE_decode(s);
 }
 
-UTF_API UTF_Point utf32BE_encode(char32_t codepoint) {
-	return utf32_encode(codepoint, UTF_BE);
+UTF_API UTF_Point utf16BE_decode(const void *s) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF16, UTF_BE>::point(static_cast<const uint8_t *>(s)));
 }
 
-UTF_API UTF_Point utf32LE_encode(char32_t codepoint) {
-	return utf32_encode(codepoint, UTF_LE);
+UTF_API UTF_Point utf16LE_decode(const void *s) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF16, UTF_LE>::point(static_cast<const uint8_t *>(s)));
+}
+
+
+UTF_API UTF_Point utf32_decode(const void *s, UTF_BOM en) {
+	return en == UTF_BE ? utf32BE_decode(s) : utf32LE_decode(s);
+}
+
+UTF_API UTF_Point utf32BE_decode(const void *s) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF32, UTF_BE>::point(static_cast<const uint8_t *>(s)));
+}
+
+UTF_API UTF_Point utf32LE_decode(const void *s) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF32, UTF_LE>::point(static_cast<const uint8_t *>(s)));
+}
+
+
+UTF_API UTF_Point utf8_decode_prev(const void *s, size_t pos) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF8>::point_prev(static_cast<const uint8_t *>(s), pos));
+}
+
+UTF_API UTF_Point utf16_decode_prev(const void *s, size_t pos, UTF_BOM en) {
+	return en == UTF_BE ? utf16BE_decode_prev(s, pos) : utf16LE_decode_prev(s, pos);
+}
+
+UTF_API UTF_Point utf16BE_decode_prev(const void *s, size_t pos) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF16, UTF_BE>::point_prev(static_cast<const uint8_t *>(s), pos * 2));
+}
+
+UTF_API UTF_Point utf16LE_decode_prev(const void *s, size_t pos) {
+	return UTF_STAT_POINT(true, utf::decoder<UTF16, UTF_LE>::point_prev(static_cast<const uint8_t *>(s), pos * 2));
+}
+
+UTF_API UTF_Point utf32_decode_prev(const void *s, size_t pos, UTF_BOM en) {
+	const uint8_t *b = static_cast<const uint8_t *>(s);
+	return UTF_STAT_POINT(true, en == UTF_BE ? utf::decoder<UTF32, UTF_BE>::point_prev(b, pos * 4) : utf::decoder<UTF32, UTF_LE>::point_prev(b, pos * 4));
+}
+
+
+
+UTF_API UTF_Point utf8_encode(char32_t codepoint) {
+	return UTF_STAT_POINT(false, utf::encoder<UTF8>::encode(codepoint));
+}
+
+
+UTF_API UTF_Point utf16_encode(char32_t codepoint, UTF_BOM en) {
+	return en == UTF_BE ? utf16BE_encode(codepoint) : utf16LE_encode(codepoint);
+}
+
+UTF_API UTF_Point utf16BE_encode(char32_t codepoint) {
+	return UTF_STAT_POINT(false, utf::encoder<UTF16, UTF_BE>::encode(codepoint));
+}
+
+UTF_API UTF_Point utf16LE_encode(char32_t codepoint) {
+	return UTF_STAT_POINT(false, utf::encoder<UTF16, UTF_LE>::encode(codepoint));
+}
+
+
+UTF_API UTF_Point utf32_encode(char32_t codepoint, UTF_BOM en) {
+	return en == UTF_BE ? utf32BE_encode(codepoint) : utf32LE_encode(codepoint);
+}
+
+UTF_API UTF_Point utf32BE_encode(char32_t codepoint) {
+	return UTF_STAT_POINT(false, utf::encoder<UTF32, UTF_BE>::encode(codepoint));
+}
+
+UTF_API UTF_Point utf32LE_encode(char32_t codepoint) {
+	return UTF_STAT_POINT(false, utf::encoder<UTF32, UTF_LE>::encode(codepoint));
+}
+
+
+
+// bulk
+
+#include <atomic>
+#ifndef UTF_NO_THREADS
+#include <thread>
+#include <vector>
+#endif
+
+/*
+	every instruction set is compiled in no matter what the compiler targets, the one to use is picked at runtime
+	gcc and clang need to be told which regions may use which instructions, msvc doesn't care
+*/
+
+#if !defined(UTF_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)) \
+	&& (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define UTF_SIMD
+#include <immintrin.h>
+#ifndef _MSC_VER
+#include <cpuid.h>
+#endif
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#define UTF_PRAGMA(...) _Pragma(#__VA_ARGS__)
+#if defined(__clang__)
+#define UTF_TARGET_PUSH(isa) UTF_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+#define UTF_TARGET_POP UTF_PRAGMA(clang attribute pop)
+#define UTF_FLATTEN __attribute__((flatten))
+#elif defined(__GNUC__)
+#define UTF_TARGET_PUSH(isa) UTF_PRAGMA(GCC push_options) UTF_PRAGMA(GCC target(isa))
+#define UTF_TARGET_POP UTF_PRAGMA(GCC pop_options)
+#define UTF_FLATTEN __attribute__((flatten))
+#else
+#define UTF_TARGET_PUSH(isa)
+#define UTF_TARGET_POP
+#define UTF_FLATTEN
+#endif
+
+namespace utf_detail {
+
+// length-bounded utf8_decode, classifies errors the same way
+static inline uint8_t utf8_decode_n(const uint8_t *s, size_t len, char32_t *cp, UTF_RESULT *res) {
+	uint8_t lead = s[0];
+	*res = UTF_OK;
+	*cp = 0;
+
+	if(lead < 0x80) {
+		*cp = lead;
+		return 1;
+	}
+	if(lead < 0xC0) {
+		*res = UTF_UNEXPECTED_CONTINUATION;
+		return 1;
+	}
+
+	uint8_t expWords = 2;
+	for(; expWords < 7 && (lead << expWords) & 0x80; expWords++);
+
+	char32_t c = lead & (0xff >> (expWords + 1));
+	uint8_t n = 1;
+	for(; n < expWords; n++) {
+		if(n >= len || (s[n] & 0xC0) != 0x80) {
+			*res = UTF_TOO_FEW_WORDS;
+			return n;
+		}
+		c = (c << 6) | (s[n] & 0x3f);
+	}
+
+	size_t k = n - 1;
+	size_t avl_bits = k == 1 ? 7 : (6 * (k - 1) + (7 - k));
+	if((c & ((~static_cast<size_t>(0)) << avl_bits)) == 0) *res = UTF_OVERLONG;
+	else if(!utf_is_valid_cp(c)) *res = UTF_ILLEGAL_CODEPOINT;
+
+	*cp = c;
+	return n;
+}
+
+static inline size_t ascii_prefix_scalar(const uint8_t *s, size_t len) {
+	size_t i = 0;
+	for(; i + 8 <= len; i += 8) {
+		uint64_t w;
+		memcpy(&w, s + i, 8);
+		if(w & 0x8080808080808080ull) break;
+	}
+	for(; i < len && s[i] < 0x80; i++);
+	return i;
+}
+
+// validates every sequence starting in [i, n), never reads at or past limit
+static UTF_Bulk utf8_validate_from(const uint8_t *s, size_t i, size_t n, size_t limit) {
+	UTF_Bulk ret;
+	char32_t cp;
+	while(i < n) {
+		i += ascii_prefix_scalar(s + i, n - i);
+		if(i >= n) break;
+		uint8_t w = utf8_decode_n(s + i, limit - i, &cp, &ret.result);
+		if(ret.result != UTF_OK) break;
+		i += w;
+	}
+	ret.num_read = i;
+	return ret;
+}
+
+// start of a sequence that may still be open at i
+static inline size_t utf8_rewind(const uint8_t *s, size_t i) {
+	for(size_t k = 1; k <= 3 && k <= i; k++) {
+		uint8_t b = s[i - k];
+		if((b & 0xC0) != 0x80) return b >= 0xC0 ? i - k : i;
+	}
+	return i;
+}
+
+static inline int popcount32(uint32_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcount(x);
+#else
+	x = x - ((x >> 1) & 0x55555555);
+	x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+	return static_cast<int>((((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#endif
+}
+
+static inline int popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcountll(x);
+#else
+	return popcount32(static_cast<uint32_t>(x)) + popcount32(static_cast<uint32_t>(x >> 32));
+#endif
+}
+
+// x must not be 0
+static inline int ctz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long i;
+	_BitScanForward64(&i, x);
+	return static_cast<int>(i);
+#else
+	int i = 0;
+	for(; !(x & 1); x >>= 1) i++;
+	return i;
+#endif
+}
+
+static inline void put16(uint8_t *d, uint16_t w, UTF_BOM en) {
+	d[en == UTF_BE ? 1 : 0] = static_cast<uint8_t>(w);
+	d[en == UTF_BE ? 0 : 1] = static_cast<uint8_t>(w >> 8);
+}
+
+// writes one or two words, 0 if they don't fit in room
+static inline size_t utf16_put(uint8_t *d, size_t room, char32_t cp, UTF_BOM en) {
+	if(cp < 0x10000) {
+		if(room < 1) return 0;
+		put16(d, static_cast<uint16_t>(cp), en);
+		return 1;
+	}
+	if(room < 2) return 0;
+	cp -= 0x10000;
+	put16(d, static_cast<uint16_t>(0xD800 + (cp >> 10)), en);
+	put16(d + 2, static_cast<uint16_t>(0xDC00 + (cp & 0x3FF)), en);
+	return 2;
+}
+
+static inline UTF_Bulk utf8_to_utf16_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	UTF_Bulk ret;
+	char32_t cp;
+	while(ret.num_read < len) {
+		uint8_t n = utf8_decode_n(s + ret.num_read, len - ret.num_read, &cp, &ret.result);
+		if(ret.result != UTF_OK) break;
+		size_t w = utf16_put(d + ret.num_written * 2, cap - ret.num_written, cp, en);
+		if(!w) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		ret.num_read += n;
+		ret.num_written += w;
+	}
+	return ret;
+}
+
+static inline uint16_t get16(const uint8_t *s, UTF_BOM en) {
+	return static_cast<uint16_t>(s[en == UTF_BE ? 0 : 1] << 8 | s[en == UTF_BE ? 1 : 0]);
+}
+
+// length-bounded utf16_decode
+static inline uint8_t utf16_decode_n(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cp, UTF_RESULT *res) {
+	uint16_t w0 = get16(s, en);
+	*res = UTF_OK;
+	*cp = 0;
+
+	switch(w0 & 0xFC00) {
+		case 0xDC00:
+			*res = UTF_UNEXPECTED_CONTINUATION;
+			return 1;
+		case 0xD800:
+		{
+			uint16_t w1 = len < 2 ? 0 : get16(s + 2, en);
+			if((w1 & 0xFC00) != 0xDC00) {
+				*res = UTF_TOO_FEW_WORDS;
+				return 1;
+			}
+			*cp = ((w0 & 0x3FF) << 10) + (w1 & 0x3FF) + 0x10000;
+			return 2;
+		}
+		default:
+			*cp = w0;
+			return 1;
+	}
+}
+
+// writes a valid codepoint, 0 if it doesn't fit in room
+static inline size_t utf8_put(uint8_t *d, size_t room, char32_t cp) {
+	if(cp < 0x80) {
+		if(room < 1) return 0;
+		d[0] = static_cast<uint8_t>(cp);
+		return 1;
+	}
+	if(cp < 0x800) {
+		if(room < 2) return 0;
+		d[0] = static_cast<uint8_t>(0xC0 | cp >> 6);
+		d[1] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+		return 2;
+	}
+	if(cp < 0x10000) {
+		if(room < 3) return 0;
+		d[0] = static_cast<uint8_t>(0xE0 | cp >> 12);
+		d[1] = static_cast<uint8_t>(0x80 | (cp >> 6 & 0x3F));
+		d[2] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+		return 3;
+	}
+	if(room < 4) return 0;
+	d[0] = static_cast<uint8_t>(0xF0 | cp >> 18);
+	d[1] = static_cast<uint8_t>(0x80 | (cp >> 12 & 0x3F));
+	d[2] = static_cast<uint8_t>(0x80 | (cp >> 6 & 0x3F));
+	d[3] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+	return 4;
+}
+
+// one codepoint of utf16_to_utf8, false when the caller has to stop
+static inline bool utf16_to_utf8_one(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, UTF_Bulk *ret) {
+	char32_t cp;
+	uint8_t n = utf16_decode_n(s + ret->num_read * 2, len - ret->num_read, en, &cp, &ret->result);
+	if(ret->result != UTF_OK) return false;
+	size_t w = utf8_put(d + ret->num_written, cap - ret->num_written, cp);
+	if(!w) {
+		ret->result = UTF_OUTPUT_FULL;
+		return false;
+	}
+	ret->num_read += n;
+	ret->num_written += w;
+	return true;
+}
+
+static inline UTF_Bulk utf16_to_utf8_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	UTF_Bulk ret;
+	while(ret.num_read < len && utf16_to_utf8_one(s, len, d, cap, en, &ret));
+	return ret;
+}
+
+static inline char32_t get32(const uint8_t *s, UTF_BOM en) {
+	char32_t cp = 0;
+	for(int i = 0; i < 4; i++)
+		cp |= static_cast<char32_t>(s[en == UTF_BE ? 3 - i : i]) << i * 8;
+	return cp;
+}
+
+static inline void put32(uint8_t *d, char32_t cp, UTF_BOM en) {
+	for(int i = 0; i < 4; i++)
+		d[en == UTF_BE ? 3 - i : i] = static_cast<uint8_t>(cp >> i * 8);
+}
+
+static inline UTF_Bulk utf8_to_utf32_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	UTF_Bulk ret;
+	char32_t cp;
+	while(ret.num_read < len) {
+		uint8_t n = utf8_decode_n(s + ret.num_read, len - ret.num_read, &cp, &ret.result);
+		if(ret.result != UTF_OK) break;
+		if(ret.num_written == cap) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		put32(d + ret.num_written * 4, cp, en);
+		ret.num_read += n;
+		ret.num_written++;
+	}
+	return ret;
+}
+
+// one codepoint of utf32_to_utf8, false when the caller has to stop
+static inline bool utf32_to_utf8_one(const uint8_t *s, uint8_t *d, size_t cap, UTF_BOM en, UTF_Bulk *ret) {
+	char32_t cp = get32(s + ret->num_read * 4, en);
+	if(!utf_is_valid_cp(cp)) {
+		ret->result = UTF_ILLEGAL_CODEPOINT;
+		return false;
+	}
+	size_t w = utf8_put(d + ret->num_written, cap - ret->num_written, cp);
+	if(!w) {
+		ret->result = UTF_OUTPUT_FULL;
+		return false;
+	}
+	ret->num_read++;
+	ret->num_written += w;
+	return true;
+}
+
+static inline UTF_Bulk utf32_to_utf8_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	UTF_Bulk ret;
+	while(ret.num_read < len && utf32_to_utf8_one(s, d, cap, en, &ret));
+	return ret;
+}
+
+// every byte that isn't a continuation, with pairs a 4-byte lead counts twice (it becomes a surrogate pair)
+static inline size_t utf8_count_scalar(const uint8_t *s, size_t len, bool pairs) {
+	size_t n = 0;
+	for(size_t i = 0; i < len; i++)
+		n += ((s[i] & 0xC0) != 0x80) + (pairs && s[i] >= 0xF0);
+	return n;
+}
+
+static inline size_t utf8_count_codepoints_scalar(const uint8_t *s, size_t len) { return utf8_count_scalar(s, len, false); }
+static inline size_t utf16_length_from_utf8_scalar(const uint8_t *s, size_t len) { return utf8_count_scalar(s, len, true); }
+
+// surrogates count 2 bytes each, 4 for a pair
+static inline size_t utf8_length_from_utf16_scalar(const uint8_t *s, size_t len, UTF_BOM en) {
+	size_t n = 0;
+	for(size_t i = 0; i < len; i++) {
+		uint16_t w = get16(s + i * 2, en);
+		n += w < 0x80 ? 1 : w < 0x800 ? 2 : (w & 0xF800) == 0xD800 ? 2 : 3;
+	}
+	return n;
+}
+
+static inline size_t utf8_length_from_utf32_scalar(const uint8_t *s, size_t len, UTF_BOM en) {
+	size_t n = 0;
+	for(size_t i = 0; i < len; i++) {
+		char32_t cp = get32(s + i * 4, en);
+		n += cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+	}
+	return n;
+}
+
+// one codepoint of utf16_swap (one word without validate), false when the caller has to stop
+// every word is read whole before it's written, so src can be d
+static inline bool utf16_swap_one(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate, UTF_Bulk *ret) {
+	size_t i = ret->num_read, n = 1;
+	if(validate) {
+		char32_t cp;
+		n = utf16_decode_n(s + i * 2, len - i, en, &cp, &ret->result);
+		if(ret->result != UTF_OK) return false;
+	}
+	if(n > cap - ret->num_written) {
+		ret->result = UTF_OUTPUT_FULL;
+		return false;
+	}
+	for(size_t k = i; k < i + n; k++) put16(d + k * 2, get16(s + k * 2, en), en == UTF_BE ? UTF_LE : UTF_BE);
+	ret->num_read += n;
+	ret->num_written += n;
+	return true;
+}
+
+static inline UTF_Bulk utf16_swap_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate) {
+	UTF_Bulk ret;
+	while(ret.num_read < len && utf16_swap_one(s, len, d, cap, en, validate, &ret));
+	return ret;
+}
+
+static inline bool utf32_swap_one(const uint8_t *s, uint8_t *d, size_t cap, UTF_BOM en, bool validate, UTF_Bulk *ret) {
+	size_t i = ret->num_read;
+	char32_t cp = get32(s + i * 4, en);
+	if(validate && !utf_is_valid_cp(cp)) {
+		ret->result = UTF_ILLEGAL_CODEPOINT;
+		return false;
+	}
+	if(ret->num_written == cap) {
+		ret->result = UTF_OUTPUT_FULL;
+		return false;
+	}
+	put32(d + i * 4, cp, en == UTF_BE ? UTF_LE : UTF_BE);
+	ret->num_read++;
+	ret->num_written++;
+	return true;
+}
+
+static inline UTF_Bulk utf32_swap_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate) {
+	UTF_Bulk ret;
+	while(ret.num_read < len && utf32_swap_one(s, d, cap, en, validate, &ret));
+	return ret;
+}
+
+static inline UTF_Bulk ascii_validate_scalar(const uint8_t *s, size_t len) {
+	UTF_Bulk ret;
+	ret.num_read = ascii_prefix_scalar(s, len);
+	if(ret.num_read < len) ret.result = UTF_ILLEGAL_CODEPOINT;
+	return ret;
+}
+
+// one Latin-1 byte of latin1_to_utf8, false when it doesn't fit
+static inline bool latin1_to_utf8_one(const uint8_t *s, uint8_t *d, size_t cap, UTF_Bulk *ret) {
+	if(!utf8_put(d + ret->num_written, cap - ret->num_written, s[ret->num_read])) {
+		ret->result = UTF_OUTPUT_FULL;
+		return false;
+	}
+	ret->num_written += 1 + (s[ret->num_read] >> 7);
+	ret->num_read++;
+	return true;
+}
+
+// ASCII runs are copied as they are
+static inline UTF_Bulk latin1_to_utf8_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap) {
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t rest = len - ret.num_read, room = cap - ret.num_written;
+		size_t a = ascii_prefix_scalar(s + ret.num_read, rest < room ? rest : room);
+		if(a) memcpy(d + ret.num_written, s + ret.num_read, a);
+		ret.num_read += a;
+		ret.num_written += a;
+		if(ret.num_read < len && !latin1_to_utf8_one(s, d, cap, &ret)) break;
+	}
+	return ret;
+}
+
+static inline UTF_Bulk latin1_to_utf16_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	UTF_Bulk ret;
+	size_t n = len < cap ? len : cap;
+	for(size_t i = 0; i < n; i++) put16(d + i * 2, s[i], en);
+	ret.num_read = ret.num_written = n;
+	if(n < len) ret.result = UTF_OUTPUT_FULL;
+	return ret;
+}
+
+// one codepoint of utf8_to_latin1, false when the caller has to stop
+static inline bool utf8_to_latin1_one(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_Bulk *ret) {
+	char32_t cp;
+	uint8_t n = utf8_decode_n(s + ret->num_read, len - ret->num_read, &cp, &ret->result);
+	if(ret->result != UTF_OK) return false;
+	if(cp > 0xFF) {
+		ret->result = UTF_ILLEGAL_CODEPOINT;
+		return false;
+	}
+	if(ret->num_written == cap) {
+		ret->result = UTF_OUTPUT_FULL;
+		return false;
+	}
+	d[ret->num_written++] = static_cast<uint8_t>(cp);
+	ret->num_read += n;
+	return true;
+}
+
+static inline UTF_Bulk utf8_to_latin1_scalar(const uint8_t *s, size_t len, uint8_t *d, size_t cap) {
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t rest = len - ret.num_read, room = cap - ret.num_written;
+		size_t a = ascii_prefix_scalar(s + ret.num_read, rest < room ? rest : room);
+		if(a) memcpy(d + ret.num_written, s + ret.num_read, a);
+		ret.num_read += a;
+		ret.num_written += a;
+		if(ret.num_read < len && !utf8_to_latin1_one(s, len, d, cap, &ret)) break;
+	}
+	return ret;
+}
+
+// bytes over 0x7F take two in UTF-8
+static inline size_t utf8_length_from_latin1_scalar(const uint8_t *s, size_t len) {
+	size_t n = len;
+	for(size_t i = 0; i < len; i++) n += s[i] >> 7;
+	return n;
+}
+
+// what utf_detect counts in one pass, added to c (s is 4 byte aligned in the text)
+enum {
+	DETECT_ZEROS, // 4 of them, zero bytes at each offset mod 4
+	DETECT_CONTROLS = 4, // C0 controls that aren't 0, whitespace or escape
+	DETECT_ZERO16, // zero UTF-16 words
+	// UTF-16 surrogates without their other half (one at the end isn't), in the order of UTF_BOM
+	DETECT_UNPAIRED16_BE,
+	DETECT_UNPAIRED16_LE,
+	DETECT_COUNTS
+};
+
+// from byte i (even) on, the word before it is looked at
+static inline void detect_counts_from(const uint8_t *s, size_t i, size_t len, size_t *c) {
+	for(; i < len; i++) {
+		c[DETECT_ZEROS + (i & 3)] += !s[i];
+		c[DETECT_CONTROLS] += s[i] && s[i] < 0x20 && (s[i] < 9 || s[i] > 13) && s[i] != 0x1B;
+		if(!(i & 1)) continue;
+		uint8_t a = s[i - 1], b = s[i], pa = i >= 3 ? s[i - 3] : 0, pb = i >= 3 ? s[i - 2] : 0;
+		c[DETECT_ZERO16] += !(a | b);
+		c[DETECT_UNPAIRED16_LE] += ((pb & 0xFC) == 0xD8) != ((b & 0xFC) == 0xDC);
+		c[DETECT_UNPAIRED16_BE] += ((pa & 0xFC) == 0xD8) != ((a & 0xFC) == 0xDC);
+	}
+}
+
+static inline void detect_counts_scalar(const uint8_t *s, size_t len, size_t *c) { detect_counts_from(s, 0, len, c); }
+
+static inline size_t word_size(UTF_TYPE t) {
+	return t == UTF8 ? 1 : t == UTF16 ? 2 : 4;
+}
+
+// the input that can matter to cap words of output, the rest of len is never looked at: every codepoint
+// is at least one word out and at most 4, 2 or 1 word(s) in, plus the one that stops it
+static inline size_t input_bound(size_t len, size_t cap, UTF_TYPE from) {
+	size_t w = 4 / word_size(from);
+	return cap < len / w ? (cap + 1) * w : len;
+}
+
+// one sequence from len bytes, returns its length in bytes
+// incomplete is set when the sequence is cut off by len and more bytes could still make it valid
+static inline size_t decode_any_n(const uint8_t *s, size_t len, UTF_TYPE t, UTF_BOM en, char32_t *cp, UTF_RESULT *res, bool *incomplete) {
+	*incomplete = false;
+	*cp = 0;
+	if(len < word_size(t)) {
+		*res = UTF_TOO_FEW_WORDS;
+		*incomplete = true;
+		return len;
+	}
+
+	if(t == UTF8) {
+		size_t n = utf8_decode_n(s, len, cp, res);
+		*incomplete = *res == UTF_TOO_FEW_WORDS && n == len;
+		return n;
+	}
+	if(t == UTF16) {
+		size_t n = utf16_decode_n(s, len / 2, en, cp, res);
+		*incomplete = *res == UTF_TOO_FEW_WORDS && len < 4;
+		return n * 2;
+	}
+	*cp = get32(s, en);
+	*res = utf_is_valid_cp(*cp) ? UTF_OK : UTF_ILLEGAL_CODEPOINT;
+	return 4;
+}
+
+// writes a valid codepoint in any encoding, 0 if it doesn't fit in room words
+static inline size_t put_any(uint8_t *d, size_t room, char32_t cp, UTF_TYPE t, UTF_BOM en) {
+	if(t == UTF8) return utf8_put(d, room, cp);
+	if(t == UTF16) return utf16_put(d, room, cp, en);
+	if(!room) return 0;
+	put32(d, cp, en);
+	return 1;
+}
+
+// per codepoint, for the pairs without a bulk function
+static inline UTF_Bulk transcode_scalar(const uint8_t *s, size_t len, UTF_TYPE from, UTF_BOM from_bom, uint8_t *d, size_t cap, UTF_TYPE to, UTF_BOM to_bom) {
+	UTF_Bulk ret;
+	char32_t cp;
+	bool incomplete;
+	while(ret.num_read < len) {
+		size_t n = decode_any_n(s + ret.num_read * word_size(from), (len - ret.num_read) * word_size(from), from, from_bom, &cp, &ret.result, &incomplete);
+		if(ret.result != UTF_OK) break;
+		size_t w = put_any(d + ret.num_written * word_size(to), cap - ret.num_written, cp, to, to_bom);
+		if(!w) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		ret.num_read += n / word_size(from);
+		ret.num_written += w;
+	}
+	return ret;
+}
+
+// one codepoint or ill-formed subpart (as U+FFFD) per entry, any of the columns may be null
+template<UTF_TYPE T, UTF_BOM B>
+static UTF_Bulk decode_columns_scalar(const uint8_t *s, size_t len, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	UTF_Bulk ret;
+	const size_t ws = utf::word_size(T);
+	for(; ret.num_read < len; ret.num_written++) {
+		if(ret.num_written == cap) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		UTF_Cp c = utf::decoder<T, B>::next(s + ret.num_read * ws, (len - ret.num_read) * ws);
+		if(cps) cps[ret.num_written] = c.codepoint;
+		if(offsets) offsets[ret.num_written] = static_cast<uint32_t>(ret.num_read * ws);
+		if(status) status[ret.num_written] = c.result;
+		ret.num_read += c.num_words;
+		UTF_STAT_SCALAR(c.num_words * ws);
+	}
+	return ret;
+}
+
+static inline UTF_Bulk utf8_decode_columns_scalar(const uint8_t *s, size_t len, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	return decode_columns_scalar<UTF8, UTF_LE>(s, len, cps, offsets, status, cap);
+}
+
+static inline UTF_Bulk utf16_decode_columns_scalar(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	return en == UTF_BE ? decode_columns_scalar<UTF16, UTF_BE>(s, len, cps, offsets, status, cap) :
+		decode_columns_scalar<UTF16, UTF_LE>(s, len, cps, offsets, status, cap);
+}
+
+static inline UTF_Bulk utf32_decode_columns_scalar(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	return en == UTF_BE ? decode_columns_scalar<UTF32, UTF_BE>(s, len, cps, offsets, status, cap) :
+		decode_columns_scalar<UTF32, UTF_LE>(s, len, cps, offsets, status, cap);
+}
+
+// word i of a text in any encoding
+static inline char32_t word_at(const uint8_t *s, size_t i, UTF_TYPE type, UTF_BOM en) {
+	return type == UTF8 ? s[i] : type == UTF16 ? get16(s + i * 2, en) : get32(s + i * 4, en);
+}
+
+// how many words two texts start with that are ASCII in both and the same, each of them a codepoint
+static inline size_t ascii_common_scalar(const uint8_t *a, size_t len_a, UTF_TYPE type_a, UTF_BOM bom_a, const uint8_t *b, size_t len_b, UTF_TYPE type_b, UTF_BOM bom_b) {
+	size_t i = 0;
+	for(const size_t len = len_a < len_b ? len_a : len_b; i < len; i++) {
+		char32_t x = word_at(a, i, type_a, bom_a);
+		if(x >= 0x80 || x != word_at(b, i, type_b, bom_b)) break;
+	}
+	return i;
+}
+
+enum : uint64_t { HASH_K = 0x9E3779B97F4A7C15ull };
+
+// rounds of 8 codepoints, a pair for each of 4 lanes: it adds the 64-bit product of its keyed halves and
+// the lane next to it adds the pair as it is (the way xxh3 does it, every step vectorizes); every lane
+// of every round has its own key, key + HASH_K * (4 * round + lane)
+static inline void hash_rounds_scalar(uint64_t *acc, const char32_t *cps, size_t rounds, uint64_t key) {
+	for(size_t r = 0; r < rounds; r++, cps += 8, key += 4 * HASH_K) {
+		uint64_t v[4], k[4];
+		for(int j = 0; j < 4; j++) {
+			v[j] = cps[j * 2] | static_cast<uint64_t>(cps[j * 2 + 1]) << 32;
+			k[j] = v[j] ^ (key + j * HASH_K);
+		}
+		acc[0] += (k[0] & 0xFFFFFFFF) * (k[0] >> 32) + v[1];
+		acc[1] += (k[1] & 0xFFFFFFFF) * (k[1] >> 32) + v[0];
+		acc[2] += (k[2] & 0xFFFFFFFF) * (k[2] >> 32) + v[3];
+		acc[3] += (k[3] & 0xFFFFFFFF) * (k[3] >> 32) + v[2];
+	}
+}
+
+// the ASCII bytes s starts with, the printable ones of them (a column each) added to width
+static inline size_t ascii_width_scalar(const uint8_t *s, size_t len, size_t *width) {
+	size_t i = 0;
+	for(; i < len && s[i] < 0x80; i++) *width += s[i] >= 0x20 && s[i] < 0x7F;
+	return i;
+}
+
+// the first p with s[p] == a and s[p + dist] == b (both in len), len if there is none
+static inline size_t find_pair_scalar(const uint8_t *s, size_t len, uint8_t a, uint8_t b, size_t dist) {
+	for(size_t p = 0; p + dist < len; p++) {
+		const void *q = memchr(s + p, a, len - dist - p);
+		if(!q) break;
+		p = static_cast<size_t>(static_cast<const uint8_t *>(q) - s);
+		if(s[p + dist] == b) return p;
+	}
+	return len;
+}
+
+struct utf_kernels {
+	UTF_IMPL impl;
+	UTF_Bulk (*validate)(const uint8_t *s, size_t len);
+	UTF_Bulk (*utf8_to_utf16)(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en);
+	UTF_Bulk (*utf16_to_utf8)(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en);
+	UTF_Bulk (*utf8_to_utf32)(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en);
+	UTF_Bulk (*utf32_to_utf8)(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en);
+	size_t (*utf8_count_codepoints)(const uint8_t *s, size_t len);
+	size_t (*utf16_length_from_utf8)(const uint8_t *s, size_t len);
+	size_t (*utf8_length_from_utf16)(const uint8_t *s, size_t len, UTF_BOM en);
+	size_t (*utf8_length_from_utf32)(const uint8_t *s, size_t len, UTF_BOM en);
+	UTF_Bulk (*utf16_swap)(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate);
+	UTF_Bulk (*utf32_swap)(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate);
+	void (*detect_counts)(const uint8_t *s, size_t len, size_t *c);
+	UTF_Bulk (*ascii_validate)(const uint8_t *s, size_t len);
+	UTF_Bulk (*latin1_to_utf8)(const uint8_t *s, size_t len, uint8_t *d, size_t cap);
+	UTF_Bulk (*latin1_to_utf16)(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en);
+	UTF_Bulk (*utf8_to_latin1)(const uint8_t *s, size_t len, uint8_t *d, size_t cap);
+	size_t (*utf8_length_from_latin1)(const uint8_t *s, size_t len);
+	UTF_Bulk (*utf8_decode_columns)(const uint8_t *s, size_t len, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap);
+	UTF_Bulk (*utf16_decode_columns)(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap);
+	UTF_Bulk (*utf32_decode_columns)(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap);
+	void (*hash_rounds)(uint64_t *acc, const char32_t *cps, size_t rounds, uint64_t key);
+	size_t (*find_pair)(const uint8_t *s, size_t len, uint8_t a, uint8_t b, size_t dist);
+	size_t (*ascii_width)(const uint8_t *s, size_t len, size_t *width);
+	size_t (*ascii_common)(const uint8_t *a, size_t len_a, UTF_TYPE type_a, UTF_BOM bom_a, const uint8_t *b, size_t len_b, UTF_TYPE type_b, UTF_BOM bom_b);
+};
+
+namespace scalar {
+
+static UTF_Bulk validate(const uint8_t *s, size_t len) { return utf8_validate_from(s, 0, len, len); }
+
+static const utf_kernels kernels = {
+	UTF_IMPL_SCALAR, validate, utf8_to_utf16_scalar, utf16_to_utf8_scalar, utf8_to_utf32_scalar, utf32_to_utf8_scalar,
+	utf8_count_codepoints_scalar, utf16_length_from_utf8_scalar, utf8_length_from_utf16_scalar, utf8_length_from_utf32_scalar,
+	utf16_swap_scalar, utf32_swap_scalar, detect_counts_scalar,
+	ascii_validate_scalar, latin1_to_utf8_scalar, latin1_to_utf16_scalar, utf8_to_latin1_scalar, utf8_length_from_latin1_scalar,
+	utf8_decode_columns_scalar, utf16_decode_columns_scalar, utf32_decode_columns_scalar, hash_rounds_scalar, find_pair_scalar,
+	ascii_width_scalar, ascii_common_scalar
+};
+
+} // namespace scalar
+
+#ifdef UTF_SIMD
+
+// the generic code is SSE4.2, flatten in the entry points below compiles it again for the wider sets
+UTF_TARGET_PUSH("sse4.2,popcnt")
+
+/*
+	block validation after Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"
+	every byte is checked together with the one before it using three nibble lookups,
+	a block only tells if it's valid, the exact error is then found with utf8_decode_n
+*/
+
+enum {
+	UTF8_TOO_SHORT = 1 << 0,
+	UTF8_TOO_LONG = 1 << 1,
+	UTF8_OVERLONG_3 = 1 << 2,
+	UTF8_TOO_LARGE = 1 << 3,
+	UTF8_SURROGATE = 1 << 4,
+	UTF8_OVERLONG_2 = 1 << 5,
+	UTF8_TOO_LARGE_1000 = 1 << 6,
+	UTF8_OVERLONG_4 = 1 << 6,
+	UTF8_TWO_CONTS = 1 << 7,
+	UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS,
+};
+
+static const uint8_t utf8_byte_1_high[16] = {
+	// 0___ ascii
+	UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	// 10__ continuation
+	UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+	// 1100
+	UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+	// 1101
+	UTF8_TOO_SHORT,
+	// 1110
+	UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+	// 1111
+	UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+};
+
+static const uint8_t utf8_byte_1_low[16] = {
+	UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+	UTF8_CARRY | UTF8_OVERLONG_2,
+	UTF8_CARRY,
+	UTF8_CARRY,
+	UTF8_CARRY | UTF8_TOO_LARGE,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	// ____1101 (0xED)
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+};
+
+static const uint8_t utf8_byte_2_high[16] = {
+	// 0___ ascii
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	// 1000
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+	// 1001
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+	// 101_
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+	// 11__ lead
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+};
+
+// a lead byte in the last 3 bytes of a block that needs more bytes than are left in it
+static const uint8_t utf8_incomplete_max[64] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+};
+
+template<class V>
+static inline V utf8_check_block(V in, V prev) {
+	V prev1 = in.template prev<1>(prev);
+	V special = prev1.shr4().lookup(V::table(utf8_byte_1_high))
+		& (prev1 & V::splat(0x0F)).lookup(V::table(utf8_byte_1_low))
+		& in.shr4().lookup(V::table(utf8_byte_2_high));
+
+	// 111_____ two bytes back or 1111____ three bytes back must be followed by a continuation
+	V prev2 = in.template prev<2>(prev), prev3 = in.template prev<3>(prev);
+	V must23 = (prev2.subs(V::splat(0xE0 - 0x80)) | prev3.subs(V::splat(0xF0 - 0x80))) & V::splat(0x80);
+
+	return must23 ^ special;
+}
+
+// validates like utf8_validate_from, whole blocks are only checked for errors
+// Stat counts the tail taken one codepoint at a time, a converter counts its own instead
+template<class V, bool Stat = false>
+static UTF_Bulk utf8_validate_simd(const uint8_t *s, size_t n, size_t limit) {
+	const V max_value = V::load(utf8_incomplete_max + 64 - V::N);
+	V prev = V::splat(0), prev_incomplete = V::splat(0);
+
+	size_t i = 0;
+	for(; i + V::N <= n; i += V::N) {
+		V in = V::load(s + i);
+		V err = in.is_ascii() ? prev_incomplete : utf8_check_block(in, prev);
+		if(!err.any()) {
+			prev_incomplete = in.subs(max_value);
+			prev = in;
+			continue;
+		}
+		// an error shows at most 3 bytes after the start of its sequence, everything before that is valid
+		if(!in.is_ascii()) i += ctz64(~err.eq_mask(0));
+		break;
+	}
+
+	UTF_Bulk ret = utf8_validate_from(s, utf8_rewind(s, i), n, limit);
+	if(Stat && ret.num_read > i) UTF_STAT_SCALAR(ret.num_read - i);
+	return ret;
+}
+
+
+/*
+	transcoding runs in chunks: utf8_validate_simd finds how far the input is valid,
+	then the valid part is converted without any checks
+	the mixed-length paths work on 128-bit registers, only ascii runs use the full vector width
+*/
+
+enum { UTF_CHUNK = 1 << 13 };
+
+static inline __m128i load128(const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+static inline void store128(uint8_t *p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+static inline __m128i swap16(__m128i v) { return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)); }
+
+// bit per byte that is not a continuation byte
+static inline uint32_t utf8_lead_mask(__m128i in) {
+	return ~_mm_movemask_epi8(_mm_cmplt_epi8(in, _mm_set1_epi8(static_cast<char>(0xC0)))) & 0xFFFF;
+}
+
+// bit per byte >= t
+static inline uint32_t ge_mask(__m128i in, uint8_t t) {
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(in, _mm_set1_epi8(static_cast<char>(t))), in));
+}
+
+// moves the 16-bit lanes picked by an 8-bit mask to the front
+struct utf_pack16_table {
+	uint8_t shuf[256][16];
+	constexpr utf_pack16_table() : shuf{} {
+		for(int m = 0; m < 256; m++) {
+			int k = 0;
+			for(int j = 0; j < 8; j++) {
+				if(!(m & (1 << j))) continue;
+				shuf[m][k * 2] = static_cast<uint8_t>(j * 2);
+				shuf[m][k * 2 + 1] = static_cast<uint8_t>(j * 2 + 1);
+				k++;
+			}
+			for(; k < 8; k++) shuf[m][k * 2] = shuf[m][k * 2 + 1] = 0x80;
+		}
+	}
+};
+static constexpr utf_pack16_table utf_pack16{};
+
+// moves the bytes picked by an 8-bit mask to the front
+struct utf_pack8_table {
+	uint8_t shuf[256][8];
+	constexpr utf_pack8_table() : shuf{} {
+		for(int m = 0; m < 256; m++) {
+			int k = 0;
+			for(int j = 0; j < 8; j++)
+				if(m & (1 << j)) shuf[m][k++] = static_cast<uint8_t>(j);
+			for(; k < 8; k++) shuf[m][k] = 0x80;
+		}
+	}
+};
+static constexpr utf_pack8_table utf_pack8{};
+
+// UTF-8 of 8 Latin-1 bytes from (lead, continuation) pairs, the continuation dropped where the mask
+// bit (byte over 0x7F) is clear
+struct utf_pack_latin1_table {
+	uint8_t shuf[256][16];
+	uint8_t len[256];
+	constexpr utf_pack_latin1_table() : shuf{}, len{} {
+		for(int m = 0; m < 256; m++) {
+			int k = 0;
+			for(int j = 0; j < 8; j++) {
+				shuf[m][k++] = static_cast<uint8_t>(j * 2);
+				if(m & (1 << j)) shuf[m][k++] = static_cast<uint8_t>(j * 2 + 1);
+			}
+			len[m] = static_cast<uint8_t>(k);
+			for(; k < 16; k++) shuf[m][k] = 0x80;
+		}
+	}
+};
+static constexpr utf_pack_latin1_table utf_pack_latin1{};
+
+// codepoints of the 1-3 byte sequences starting in the low 8 bytes, packed to the front
+static inline __m128i utf8_decode_bmp8(__m128i in, uint32_t leads) {
+	const __m128i m3f = _mm_set1_epi16(0x3F);
+	__m128i b0 = _mm_cvtepu8_epi16(in);
+	__m128i c1 = _mm_and_si128(_mm_cvtepu8_epi16(_mm_srli_si128(in, 1)), m3f);
+	__m128i c2 = _mm_and_si128(_mm_cvtepu8_epi16(_mm_srli_si128(in, 2)), m3f);
+
+	__m128i v2 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1F)), 6), c1);
+	__m128i v3 = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12), _mm_slli_epi16(c1, 6)), c2);
+
+	__m128i r = _mm_blendv_epi8(b0, v2, _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xBF)));
+	r = _mm_blendv_epi8(r, v3, _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xDF)));
+	return _mm_shuffle_epi8(r, load128(utf_pack16.shuf[leads & 0xFF]));
+}
+
+// 8 two byte sequences
+static inline __m128i utf8_decode_2x8(__m128i in) {
+	return _mm_or_si128(
+		_mm_slli_epi16(_mm_and_si128(in, _mm_set1_epi16(0x1F)), 6),
+		_mm_and_si128(_mm_srli_epi16(in, 8), _mm_set1_epi16(0x3F)));
+}
+
+// 4 three byte sequences from the low 12 bytes, as 32-bit lanes
+static inline __m128i utf8_decode_3x4(__m128i in) {
+	__m128i x = _mm_shuffle_epi8(in, _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1));
+	return _mm_or_si128(_mm_or_si128(
+		_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(0x0F)), 12),
+		_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(x, 8), _mm_set1_epi32(0x3F)), 6)),
+		_mm_and_si128(x, _mm_set1_epi32(0x3F)));
+}
+
+// 4 four byte sequences as 32-bit lanes
+static inline __m128i utf8_decode_4x4(__m128i in) {
+	const __m128i m3f = _mm_set1_epi32(0x3F);
+	__m128i x = _mm_shuffle_epi8(in, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+	return _mm_or_si128(
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(x, 24), _mm_set1_epi32(0x07)), 18),
+			_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(x, 16), m3f), 12)),
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(x, 8), m3f), 6), _mm_and_si128(x, m3f)));
+}
+
+// surrogate pairs of codepoints above the BMP in 32-bit lanes, high word first
+static inline __m128i utf16_pairs(__m128i cp) {
+	__m128i t = _mm_sub_epi32(cp, _mm_set1_epi32(0x10000));
+	return _mm_or_si128(
+		_mm_add_epi32(_mm_srli_epi32(t, 10), _mm_set1_epi32(0xD800)),
+		_mm_slli_epi32(_mm_add_epi32(_mm_and_si128(t, _mm_set1_epi32(0x3FF)), _mm_set1_epi32(0xDC00)), 16));
+}
+
+// codepoints of the sequences starting in the low 4 bytes as 32-bit lanes, any length
+static inline __m128i utf8_decode_any4(__m128i in) {
+	const __m128i m3f = _mm_set1_epi32(0x3F);
+	__m128i b0 = _mm_cvtepu8_epi32(in);
+	__m128i c1 = _mm_and_si128(_mm_cvtepu8_epi32(_mm_srli_si128(in, 1)), m3f);
+	__m128i c2 = _mm_and_si128(_mm_cvtepu8_epi32(_mm_srli_si128(in, 2)), m3f);
+	__m128i c3 = _mm_and_si128(_mm_cvtepu8_epi32(_mm_srli_si128(in, 3)), m3f);
+
+	__m128i v2 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x1F)), 6), c1);
+	__m128i v3 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x0F)), 12), _mm_slli_epi32(c1, 6)), c2);
+	__m128i v4 = _mm_or_si128(
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x07)), 18), _mm_slli_epi32(c1, 12)),
+		_mm_or_si128(_mm_slli_epi32(c2, 6), c3));
+
+	__m128i r = _mm_blendv_epi8(b0, v2, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xBF)));
+	r = _mm_blendv_epi8(r, v3, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xDF)));
+	return _mm_blendv_epi8(r, v4, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xEF)));
+}
+
+// packs 32-bit lanes holding one word or a surrogate pair (high word first),
+// indexed by the kept lanes | the lanes with pairs << 4
+struct utf_pack_pairs_table {
+	uint8_t shuf[256][16];
+	uint8_t len[256];
+	constexpr utf_pack_pairs_table() : shuf{}, len{} {
+		for(int m = 0; m < 256; m++) {
+			int k = 0;
+			for(int j = 0; j < 4; j++) {
+				if(!(m & (1 << j))) continue;
+				int n = m & (16 << j) ? 4 : 2;
+				for(int b = 0; b < n; b++) shuf[m][k++] = static_cast<uint8_t>(j * 4 + b);
+			}
+			len[m] = static_cast<uint8_t>(k / 2);
+			for(; k < 16; k++) shuf[m][k] = 0x80;
+		}
+	}
+};
+static constexpr utf_pack_pairs_table utf_pack_pairs{};
+
+// UTF-16 of the sequences starting in the low 4 bytes, returns the number of words
+static inline size_t utf8_decode_utf16x4(__m128i in, uint32_t leads, __m128i *out) {
+	__m128i cp = utf8_decode_any4(in);
+	__m128i sup = _mm_cmpgt_epi32(cp, _mm_set1_epi32(0xFFFF));
+	uint32_t m = (leads & 0xF) | (_mm_movemask_ps(_mm_castsi128_ps(sup)) << 4);
+	*out = _mm_shuffle_epi8(_mm_blendv_epi8(cp, utf16_pairs(cp), sup), load128(utf_pack_pairs.shuf[m]));
+	return utf_pack_pairs.len[m];
+}
+
+// converts the already validated [i, end), stops early only when out of room
+template<class V>
+static size_t utf8_to_utf16_valid(const uint8_t *s, size_t i, size_t end, uint8_t *d, size_t *o, size_t cap, UTF_BOM en) {
+	const bool be = en == UTF_BE;
+	char32_t cp;
+	UTF_RESULT res;
+
+	while(i < end) {
+		size_t room = cap - *o;
+		uint8_t *out = d + *o * 2;
+
+		if(i + V::N <= end && room >= V::N) {
+			V in = V::load(s + i);
+			if(in.is_ascii()) {
+				in.widen16(out, en);
+				i += V::N;
+				*o += V::N;
+				continue;
+			}
+		}
+
+		if(i + 16 <= end && room >= 16) {
+			__m128i in = load128(s + i);
+			uint32_t leads = utf8_lead_mask(in);
+			__m128i w;
+			size_t nin, nout;
+
+			if(!_mm_movemask_epi8(in)) {
+				w = _mm_cvtepu8_epi16(in);
+				store128(out + 16, be ? _mm_slli_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(in, 8)), 8) : _mm_cvtepu8_epi16(_mm_srli_si128(in, 8)));
+				if(be) w = _mm_slli_epi16(w, 8);
+				store128(out, w);
+				i += 16;
+				*o += 16;
+				continue;
+			}
+			else if(leads == 0x5555 && !ge_mask(in, 0xE0)) {
+				w = utf8_decode_2x8(in);
+				nin = 16;
+				nout = 8;
+			}
+			else if((leads & 0x1FFF) == 0x1249) {
+				__m128i x = utf8_decode_3x4(in);
+				w = _mm_packus_epi32(x, x);
+				nin = 12;
+				nout = 4;
+			}
+			else if(leads == 0x1111) {
+				w = utf16_pairs(utf8_decode_4x4(in));
+				nin = 16;
+				nout = 8;
+			}
+			else if(!(ge_mask(in, 0xF0) & 0xFF)) {
+				w = utf8_decode_bmp8(in, leads);
+				nin = ctz64(leads & 0xFF00);
+				nout = popcount32(leads & 0xFF);
+			}
+			else {
+				nout = utf8_decode_utf16x4(in, leads, &w);
+				nin = ctz64(leads & 0xFFF0);
+			}
+
+			store128(out, be ? swap16(w) : w);
+			i += nin;
+			*o += nout;
+			continue;
+		}
+
+		uint8_t n = utf8_decode_n(s + i, end - i, &cp, &res);
+		size_t w = utf16_put(out, room, cp, en);
+		if(!w) break;
+		i += n;
+		*o += w;
+		UTF_STAT_SCALAR(n);
+	}
+	return i;
+}
+
+// lays out 1-4 byte encodings held in 32-bit lanes, indexed by 2 bits (length - 1) per lane
+struct utf_pack_utf8_table {
+	uint8_t shuf[256][16];
+	uint8_t len[256];
+	constexpr utf_pack_utf8_table() : shuf{}, len{} {
+		for(int m = 0; m < 256; m++) {
+			int k = 0;
+			for(int j = 0; j < 4; j++) {
+				int n = (m >> (j * 2) & 3) + 1;
+				for(int b = 0; b < n; b++) shuf[m][k++] = static_cast<uint8_t>(j * 4 + b);
+			}
+			len[m] = static_cast<uint8_t>(k);
+			for(; k < 16; k++) shuf[m][k] = 0x80;
+		}
+	}
+};
+static constexpr utf_pack_utf8_table utf_pack_utf8{};
+
+// table index from four byte counts minus one, one per byte of x
+static inline uint32_t lane_codes(uint32_t x) {
+	return (x | x >> 6 | x >> 12 | x >> 18) & 0xFF;
+}
+
+// UTF-8 of 4 valid codepoints, returns the number of bytes
+static inline size_t utf8_encode4(__m128i cp, __m128i *out) {
+	const __m128i m3f = _mm_set1_epi32(0x3F), c80 = _mm_set1_epi32(0x80);
+	__m128i t3 = _mm_or_si128(_mm_and_si128(cp, m3f), c80);
+	__m128i t2 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(cp, 6), m3f), c80);
+	__m128i t1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(cp, 12), m3f), c80);
+
+	__m128i e2 = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(cp, 6), _mm_set1_epi32(0xC0)), _mm_slli_epi32(t3, 8));
+	__m128i e3 = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(cp, 12), _mm_set1_epi32(0xE0)),
+		_mm_or_si128(_mm_slli_epi32(t2, 8), _mm_slli_epi32(t3, 16)));
+	__m128i e4 = _mm_or_si128(
+		_mm_or_si128(_mm_or_si128(_mm_srli_epi32(cp, 18), _mm_set1_epi32(0xF0)), _mm_slli_epi32(t1, 8)),
+		_mm_or_si128(_mm_slli_epi32(t2, 16), _mm_slli_epi32(t3, 24)));
+
+	__m128i ge2 = _mm_cmpgt_epi32(cp, _mm_set1_epi32(0x7F));
+	__m128i ge3 = _mm_cmpgt_epi32(cp, _mm_set1_epi32(0x7FF));
+	__m128i ge4 = _mm_cmpgt_epi32(cp, _mm_set1_epi32(0xFFFF));
+	__m128i r = _mm_blendv_epi8(cp, e2, ge2);
+	r = _mm_blendv_epi8(r, e3, ge3);
+	r = _mm_blendv_epi8(r, e4, ge4);
+
+	__m128i n = _mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(_mm_add_epi32(ge2, ge3), ge4));
+	n = _mm_packs_epi32(n, n);
+	uint32_t m = lane_codes(static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(n, n))));
+	*out = _mm_shuffle_epi8(r, load128(utf_pack_utf8.shuf[m]));
+	return utf_pack_utf8.len[m];
+}
+
+// UTF-8 of 8 words below the surrogates in 16-bit lanes, writes up to 32 bytes and returns the number used
+static inline size_t utf8_encode_bmp8(__m128i w, uint8_t *out) {
+	const __m128i m3f = _mm_set1_epi16(0x3F), c80 = _mm_set1_epi16(0x80);
+	__m128i t3 = _mm_or_si128(_mm_and_si128(w, m3f), c80);
+	__m128i t2 = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(w, 6), m3f), c80);
+	__m128i lt2 = _mm_cmpeq_epi16(_mm_and_si128(w, _mm_set1_epi16(static_cast<short>(0xFF80))), _mm_setzero_si128());
+	__m128i lt3 = _mm_cmpeq_epi16(_mm_and_si128(w, _mm_set1_epi16(static_cast<short>(0xF800))), _mm_setzero_si128());
+
+	// first two bytes of every character, the third one of a 3-byte character is t3
+	__m128i e2 = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(w, 6), _mm_set1_epi16(0xC0)), _mm_slli_epi16(t3, 8));
+	__m128i e3 = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(w, 12), _mm_set1_epi16(0xE0)), _mm_slli_epi16(t2, 8));
+	__m128i r = _mm_blendv_epi8(_mm_blendv_epi8(e3, e2, lt3), w, lt2);
+
+	__m128i n = _mm_add_epi16(_mm_add_epi16(lt2, lt3), _mm_set1_epi16(2));
+	n = _mm_packus_epi16(n, n);
+	uint32_t m0 = lane_codes(static_cast<uint32_t>(_mm_cvtsi128_si32(n)));
+	uint32_t m1 = lane_codes(static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(n, 4))));
+
+	store128(out, _mm_shuffle_epi8(_mm_unpacklo_epi16(r, t3), load128(utf_pack_utf8.shuf[m0])));
+	store128(out + utf_pack_utf8.len[m0], _mm_shuffle_epi8(_mm_unpackhi_epi16(r, t3), load128(utf_pack_utf8.shuf[m1])));
+	return utf_pack_utf8.len[m0] + utf_pack_utf8.len[m1];
+}
+
+// moves the 32-bit lanes picked by a 4-bit mask to the front
+struct utf_pack32_table {
+	uint8_t shuf[16][16];
+	constexpr utf_pack32_table() : shuf{} {
+		for(int m = 0; m < 16; m++) {
+			int k = 0;
+			for(int j = 0; j < 4; j++)
+				if(m & (1 << j))
+					for(int b = 0; b < 4; b++) shuf[m][k++] = static_cast<uint8_t>(j * 4 + b);
+			for(; k < 16; k++) shuf[m][k] = 0x80;
+		}
+	}
+};
+static constexpr utf_pack32_table utf_pack32{};
+
+// bit per 16-bit lane
+static inline uint32_t mask16(__m128i cmp) {
+	return _mm_movemask_epi8(_mm_packs_epi16(cmp, _mm_setzero_si128()));
+}
+
+// words w followed by next in 32-bit lanes, combines the pairs and moves the lanes in keep to the front
+static inline __m128i utf16_combine4(__m128i w, __m128i next, uint32_t keep) {
+	__m128i pair = _mm_add_epi32(
+		_mm_slli_epi32(_mm_sub_epi32(w, _mm_set1_epi32(0xD800)), 10),
+		_mm_sub_epi32(next, _mm_set1_epi32(0xDC00 - 0x10000)));
+	__m128i is_hi = _mm_cmpeq_epi32(_mm_and_si128(w, _mm_set1_epi32(0xFC00)), _mm_set1_epi32(0xD800));
+	return _mm_shuffle_epi8(_mm_blendv_epi8(w, pair, is_hi), load128(utf_pack32.shuf[keep]));
+}
+
+// utf16_combine4 and the UTF-8 of the lanes kept
+static inline size_t utf16_pairs4(__m128i w, __m128i next, uint32_t keep, uint8_t *out) {
+	__m128i cp = utf16_combine4(w, next, keep), x;
+	size_t n = utf8_encode4(cp, &x) - (4 - popcount32(keep));
+	store128(out, x);
+	return n;
+}
+
+template<class V>
+static UTF_Bulk utf16_to_utf8_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	const bool be = en == UTF_BE;
+	UTF_Bulk ret;
+
+	while(ret.num_read < len) {
+		size_t i = ret.num_read, room = cap - ret.num_written;
+		uint8_t *out = d + ret.num_written;
+
+		if(i + 8 <= len && room >= 32) {
+			__m128i in = load128(s + i * 2);
+			if(be) in = swap16(in);
+
+			if(_mm_testz_si128(in, _mm_set1_epi16(static_cast<short>(0xFF80)))) {
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(in, in));
+				ret.num_read += 8;
+				ret.num_written += 8;
+
+				// more ASCII is likely to follow
+				while(ret.num_read + V::N <= len && cap - ret.num_written >= V::N) {
+					V a = V::load(s + ret.num_read * 2), b = V::load(s + ret.num_read * 2 + V::N);
+					if(be) {
+						a = a.swap16();
+						b = b.swap16();
+					}
+					if(!(a | b).is_ascii16()) break;
+					V::narrow16(a, b, d + ret.num_written);
+					ret.num_read += V::N;
+					ret.num_written += V::N;
+				}
+				continue;
+			}
+
+			__m128i top = _mm_and_si128(in, _mm_set1_epi16(static_cast<short>(0xFC00)));
+			uint32_t hi = mask16(_mm_cmpeq_epi16(top, _mm_set1_epi16(static_cast<short>(0xD800))));
+			uint32_t lo = mask16(_mm_cmpeq_epi16(top, _mm_set1_epi16(static_cast<short>(0xDC00))));
+
+			if(!(hi | lo)) {
+				ret.num_written += utf8_encode_bmp8(in, out);
+				ret.num_read += 8;
+				continue;
+			}
+
+			// four pairs, all of them 4 bytes long
+			if(hi == 0x55 && lo == 0xAA) {
+				const __m128i m3f = _mm_set1_epi32(0x3F), c80 = _mm_set1_epi32(0x80);
+				__m128i cp = _mm_add_epi32(_mm_or_si128(
+					_mm_slli_epi32(_mm_and_si128(in, _mm_set1_epi32(0x3FF)), 10),
+					_mm_and_si128(_mm_srli_epi32(in, 16), _mm_set1_epi32(0x3FF))), _mm_set1_epi32(0x10000));
+				__m128i r = _mm_or_si128(
+					_mm_or_si128(_mm_or_si128(_mm_srli_epi32(cp, 18), _mm_set1_epi32(0xF0)),
+						_mm_slli_epi32(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(cp, 12), m3f), c80), 8)),
+					_mm_or_si128(_mm_slli_epi32(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(cp, 6), m3f), c80), 16),
+						_mm_slli_epi32(_mm_or_si128(_mm_and_si128(cp, m3f), c80), 24)));
+				store128(out, r);
+				ret.num_written += 16;
+				ret.num_read += 8;
+				continue;
+			}
+
+			// every high surrogate has to be followed by a low one, one in word 7 waits for the next window
+			if(!(((hi << 1) ^ lo) & 0xFF)) {
+				uint32_t keep = ~(lo | (hi & 0x80));
+				size_t n = utf16_pairs4(_mm_cvtepu16_epi32(in), _mm_cvtepu16_epi32(_mm_srli_si128(in, 2)), keep & 0xF, out);
+				n += utf16_pairs4(_mm_cvtepu16_epi32(_mm_srli_si128(in, 8)), _mm_cvtepu16_epi32(_mm_srli_si128(in, 10)), keep >> 4 & 0xF, out + n);
+				ret.num_written += n;
+				ret.num_read += 8 - (hi >> 7);
+				continue;
+			}
+		}
+
+		size_t r = ret.num_read;
+		if(!utf16_to_utf8_one(s, len, d, cap, en, &ret)) break;
+		UTF_STAT_SCALAR((ret.num_read - r) * 2);
+	}
+	return ret;
+}
+
+static inline __m128i swap32(__m128i v) {
+	return _mm_shuffle_epi8(v, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+}
+
+static inline void store32(uint8_t *p, __m128i cp, bool be) { store128(p, be ? swap32(cp) : cp); }
+
+// converts the already validated [i, end), stops early only when out of room
+template<class V>
+static size_t utf8_to_utf32_valid(const uint8_t *s, size_t i, size_t end, uint8_t *d, size_t *o, size_t cap, UTF_BOM en) {
+	const bool be = en == UTF_BE;
+	char32_t cp;
+	UTF_RESULT res;
+
+	while(i < end) {
+		size_t room = cap - *o;
+		uint8_t *out = d + *o * 4;
+
+		if(i + 16 <= end && room >= 16) {
+			__m128i in = load128(s + i);
+			uint32_t leads = utf8_lead_mask(in);
+
+			if(!_mm_movemask_epi8(in)) {
+				store32(out, _mm_cvtepu8_epi32(in), be);
+				store32(out + 16, _mm_cvtepu8_epi32(_mm_srli_si128(in, 4)), be);
+				store32(out + 32, _mm_cvtepu8_epi32(_mm_srli_si128(in, 8)), be);
+				store32(out + 48, _mm_cvtepu8_epi32(_mm_srli_si128(in, 12)), be);
+				i += 16;
+				*o += 16;
+			}
+			else if(leads == 0x5555 && !ge_mask(in, 0xE0)) {
+				__m128i w = utf8_decode_2x8(in);
+				store32(out, _mm_cvtepu16_epi32(w), be);
+				store32(out + 16, _mm_cvtepu16_epi32(_mm_srli_si128(w, 8)), be);
+				i += 16;
+				*o += 8;
+			}
+			else if((leads & 0x1FFF) == 0x1249) {
+				store32(out, utf8_decode_3x4(in), be);
+				i += 12;
+				*o += 4;
+			}
+			else if(leads == 0x1111) {
+				store32(out, utf8_decode_4x4(in), be);
+				i += 16;
+				*o += 4;
+			}
+			else if(!(ge_mask(in, 0xF0) & 0xFF)) {
+				__m128i w = utf8_decode_bmp8(in, leads);
+				store32(out, _mm_cvtepu16_epi32(w), be);
+				store32(out + 16, _mm_cvtepu16_epi32(_mm_srli_si128(w, 8)), be);
+				i += ctz64(leads & 0xFF00);
+				*o += popcount32(leads & 0xFF);
+			}
+			else {
+				store32(out, _mm_shuffle_epi8(utf8_decode_any4(in), load128(utf_pack32.shuf[leads & 0xF])), be);
+				i += ctz64(leads & 0xFFF0);
+				*o += popcount32(leads & 0xF);
+			}
+			continue;
+		}
+
+		uint8_t n = utf8_decode_n(s + i, end - i, &cp, &res);
+		if(!room) break;
+		put32(out, cp, en);
+		i += n;
+		(*o)++;
+		UTF_STAT_SCALAR(n);
+	}
+	return i;
+}
+
+// lanes holding a codepoint that passes utf_is_valid_cp
+static inline __m128i utf32_valid4(__m128i cp) {
+	__m128i in_range = _mm_cmpeq_epi32(_mm_min_epu32(cp, _mm_set1_epi32(0x10FFFF)), cp);
+	__m128i surrogate = _mm_cmpeq_epi32(_mm_and_si128(cp, _mm_set1_epi32(static_cast<int>(0xFFFFF800))), _mm_set1_epi32(0xD800));
+	return _mm_andnot_si128(surrogate, in_range);
+}
+
+static UTF_Bulk utf32_to_utf8_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	const bool be = en == UTF_BE;
+	UTF_Bulk ret;
+
+	while(ret.num_read < len) {
+		size_t i = ret.num_read;
+		uint8_t *out = d + ret.num_written;
+
+		if(i + 8 <= len && cap - ret.num_written >= 32) {
+			__m128i a = load128(s + i * 4), b = load128(s + i * 4 + 16);
+			if(be) {
+				a = swap32(a);
+				b = swap32(b);
+			}
+
+			// invalid words are left to the scalar path to report
+			if(_mm_movemask_epi8(_mm_and_si128(utf32_valid4(a), utf32_valid4(b))) == 0xFFFF) {
+				__m128i ab = _mm_or_si128(a, b);
+				if(_mm_testz_si128(ab, _mm_set1_epi32(~0x7F))) {
+					__m128i w = _mm_packus_epi32(a, b);
+					_mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(w, w));
+					ret.num_written += 8;
+				}
+				else if(_mm_testz_si128(ab, _mm_set1_epi32(~0xFFFF))) {
+					ret.num_written += utf8_encode_bmp8(_mm_packus_epi32(a, b), out);
+				}
+				else {
+					__m128i x;
+					size_t n = utf8_encode4(a, &x);
+					store128(out, x);
+					ret.num_written += n + utf8_encode4(b, &x);
+					store128(out + n, x);
+				}
+				ret.num_read += 8;
+				continue;
+			}
+		}
+
+		if(!utf32_to_utf8_one(s, d, cap, en, &ret)) break;
+		UTF_STAT_SCALAR(4);
+	}
+	return ret;
+}
+
+// counts like utf8_count_scalar
+template<class V>
+static size_t utf8_count_simd(const uint8_t *s, size_t len, bool pairs) {
+	size_t n = 0, i = 0;
+	for(; i + V::N <= len; i += V::N) {
+		V in = V::load(s + i);
+		n += V::N - popcount64(in.cont_mask());
+		if(pairs) n += popcount64(in.ge_mask(0xF0));
+	}
+	return n + utf8_count_scalar(s + i, len - i, pairs);
+}
+
+static size_t utf8_length_from_utf16_simd(const uint8_t *s, size_t len, UTF_BOM en) {
+	const __m128i zero = _mm_setzero_si128();
+	size_t n = 0, i = 0;
+	for(; i + 8 <= len; i += 8) {
+		__m128i w = load128(s + i * 2);
+		if(en == UTF_BE) w = swap16(w);
+		// 3 bytes per word, one less below 0x800, below 0x80 and for surrogates, 2 mask bits per word
+		__m128i lt80 = _mm_cmpeq_epi16(_mm_and_si128(w, _mm_set1_epi16(static_cast<short>(0xFF80))), zero);
+		__m128i lt800 = _mm_cmpeq_epi16(_mm_and_si128(w, _mm_set1_epi16(static_cast<short>(0xF800))), zero);
+		__m128i sur = _mm_cmpeq_epi16(_mm_and_si128(w, _mm_set1_epi16(static_cast<short>(0xF800))), _mm_set1_epi16(static_cast<short>(0xD800)));
+		n += 24 - (popcount32(_mm_movemask_epi8(lt80)) + popcount32(_mm_movemask_epi8(lt800)) + popcount32(_mm_movemask_epi8(sur))) / 2;
+	}
+	return n + utf8_length_from_utf16_scalar(s + i * 2, len - i, en);
+}
+
+static size_t utf8_length_from_utf32_simd(const uint8_t *s, size_t len, UTF_BOM en) {
+	size_t n = 0, i = 0;
+	for(; i + 4 <= len; i += 4) {
+		__m128i cp = load128(s + i * 4);
+		if(en == UTF_BE) cp = swap32(cp);
+		__m128i lt80 = _mm_cmpeq_epi32(_mm_min_epu32(cp, _mm_set1_epi32(0x7F)), cp);
+		__m128i lt800 = _mm_cmpeq_epi32(_mm_min_epu32(cp, _mm_set1_epi32(0x7FF)), cp);
+		__m128i lt10000 = _mm_cmpeq_epi32(_mm_min_epu32(cp, _mm_set1_epi32(0xFFFF)), cp);
+		n += 16 - popcount32(_mm_movemask_ps(_mm_castsi128_ps(lt80)))
+			- popcount32(_mm_movemask_ps(_mm_castsi128_ps(lt800)))
+			- popcount32(_mm_movemask_ps(_mm_castsi128_ps(lt10000)));
+	}
+	return n + utf8_length_from_utf32_scalar(s + i * 4, len - i, en);
+}
+
+// 8 words if none of them is a surrogate without its other half in them, a high one last shifts out
+// of the 16 bits lo has
+static inline bool utf16_swap8(const uint8_t *s, uint8_t *d, UTF_BOM en, UTF_Bulk *ret) {
+	__m128i in = load128(s + ret->num_read * 2), out = swap16(in), w = _mm_and_si128(en == UTF_BE ? out : in, _mm_set1_epi16(static_cast<short>(0xFC00)));
+	uint32_t hi = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(w, _mm_set1_epi16(static_cast<short>(0xD800)))));
+	uint32_t lo = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(w, _mm_set1_epi16(static_cast<short>(0xDC00)))));
+	if(lo != hi << 2) return false;
+	store128(d + ret->num_written * 2, out);
+	ret->num_read += 8;
+	ret->num_written += 8;
+	return true;
+}
+
+// whole vectors are swapped and stored only when all of them go through, of one that doesn't the
+// 16 bytes at a time before the bad word are; anything else is left to the scalar path (so src can
+// be d), a high surrogate in the last word waits for the next vector
+template<class V>
+static UTF_Bulk utf16_swap_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate) {
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t i = ret.num_read;
+		if(i + V::N / 2 <= len && cap - ret.num_written >= V::N / 2) {
+			V in = V::load(s + i * 2), out = in.swap16(), w = en == UTF_BE ? out : in;
+			// 2 mask bits per word, every low surrogate right after a high one
+			uint64_t hi = validate ? w.eq16_mask(0xFC00, 0xD800) : 0, lo = validate ? w.eq16_mask(0xFC00, 0xDC00) : 0;
+			if(lo == hi << 2 && !(hi >> (V::N - 2))) {
+				out.store(d + i * 2);
+				ret.num_read += V::N / 2;
+				ret.num_written += V::N / 2;
+				continue;
+			}
+			// up to the bad word 16 bytes at a time, not a word at a time through the whole vector
+			while(V::N > 16 && ret.num_read + 8 <= i + V::N / 2 && utf16_swap8(s, d, en, &ret));
+		}
+		size_t r = ret.num_read;
+		if(!utf16_swap_one(s, len, d, cap, en, validate, &ret)) break;
+		UTF_STAT_SCALAR((ret.num_read - r) * 2);
+	}
+	return ret;
+}
+
+template<class V>
+static UTF_Bulk utf32_swap_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate) {
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t i = ret.num_read;
+		if(i + V::N / 4 <= len && cap - ret.num_written >= V::N / 4) {
+			V in = V::load(s + i * 4), out = in.swap32();
+			uint64_t bad = validate ? (en == UTF_BE ? out : in).invalid32_mask() : 0;
+			if(!bad) {
+				out.store(d + i * 4);
+				ret.num_read += V::N / 4;
+				ret.num_written += V::N / 4;
+				continue;
+			}
+			// the words before the bad one 16 bytes at a time, then one at a time up to it
+			for(size_t good = i + ctz64(bad); ret.num_read < good;) {
+				if(ret.num_read + 4 > good) {
+					utf32_swap_one(s, d, cap, en, false, &ret);
+					continue;
+				}
+				store128(d + ret.num_read * 4, swap32(load128(s + ret.num_read * 4)));
+				ret.num_read += 4;
+				ret.num_written += 4;
+			}
+		}
+		if(!utf32_swap_one(s, d, cap, en, validate, &ret)) break;
+		UTF_STAT_SCALAR(4);
+	}
+	return ret;
+}
+
+// the surrogates are matched up with 2 mask bits per word, a high one in the last word of a vector
+// carries over to the next
+template<class V>
+static void detect_counts_simd(const uint8_t *s, size_t len, size_t *c) {
+	// counted in registers, c could be anywhere s is
+	size_t n[DETECT_COUNTS] = { 0 }, i = 0;
+	uint64_t lanes = ~0ull >> (64 - V::N), carry[2] = { 0, 0 };
+	for(; i + V::N <= len; i += V::N) {
+		V in = V::load(s + i);
+		uint64_t zero = ~in.ge_mask(1) & lanes;
+		for(int k = 0; k < 4; k++) n[DETECT_ZEROS + k] += popcount64(zero & 0x1111111111111111ull << k);
+		// 1 - 8, 14 - 31 but 27
+		uint64_t ws = (in.ge_mask(9) & ~in.ge_mask(14)) | (in.ge_mask(0x1B) & ~in.ge_mask(0x1C));
+		n[DETECT_CONTROLS] += popcount64(in.ge_mask(1) & ~in.ge_mask(0x20) & ~ws);
+		n[DETECT_ZERO16] += popcount64(in.eq16_mask(0xFFFF, 0)) / 2;
+		for(int en = UTF_BE; en <= UTF_LE; en++) {
+			V w = en == UTF_BE ? in.swap16() : in;
+			uint64_t hi = w.eq16_mask(0xFC00, 0xD800), lo = w.eq16_mask(0xFC00, 0xDC00);
+			n[DETECT_UNPAIRED16_BE + en] += popcount64(((hi << 2 | carry[en]) ^ lo) & lanes) / 2;
+			carry[en] = hi >> (V::N - 2);
+		}
+	}
+	for(int k = 0; k < DETECT_COUNTS; k++) c[k] += n[k];
+	detect_counts_from(s, i, len, c);
+}
+
+// ASCII needs no validation, a run of it is widened to W-byte words as it's read, returns its length
+template<class V, size_t W>
+static size_t ascii_widen_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	size_t i = 0;
+	for(; i + V::N <= len && i + V::N <= cap; i += V::N) {
+		V in = V::load(s + i);
+		if(!in.is_ascii()) break;
+		if(W == 1) in.store(d + i);
+		else if(W == 2) in.widen16(d + i * 2, en);
+		else in.widen32(d + i * 4, en);
+	}
+	return i;
+}
+
+// validates a chunk and hands the valid part to Convert, which only stops when out of room
+// ASCII in front of a chunk goes straight to the output in one pass
+template<class V, size_t W, size_t (*Convert)(const uint8_t *, size_t, size_t, uint8_t *, size_t *, size_t, UTF_BOM)>
+static UTF_Bulk utf8_convert_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t a = ascii_widen_simd<V, W>(s + ret.num_read, len - ret.num_read, d + ret.num_written * W, cap - ret.num_written, en);
+		ret.num_read += a;
+		ret.num_written += a;
+		if(ret.num_read == len) break;
+
+		// no more than the room left can take, a small cap isn't paid for with validation thrown away
+		size_t i = ret.num_read, rest = input_bound(len - i, cap - ret.num_written, UTF8);
+		UTF_Bulk v = utf8_validate_simd<V>(s + i, rest < UTF_CHUNK ? rest : static_cast<size_t>(UTF_CHUNK), len - i);
+
+		ret.num_read = Convert(s, i, i + v.num_read, d, &ret.num_written, cap, en);
+		if(ret.num_read != i + v.num_read) ret.result = UTF_OUTPUT_FULL;
+		else ret.result = v.result;
+		if(ret.result != UTF_OK) break;
+	}
+	return ret;
+}
+
+template<class V>
+static UTF_Bulk ascii_validate_simd(const uint8_t *s, size_t len) {
+	// one vector, then on from an aligned address: a load across two cache lines costs two
+	size_t i = 0;
+	if(len >= V::N && V::load(s).is_ascii()) i = V::N - reinterpret_cast<uintptr_t>(s) % V::N;
+	for(; i + 2 * V::N <= len; i += 2 * V::N)
+		if(!(V::load(s + i) | V::load(s + i + V::N)).is_ascii()) break;
+	UTF_Bulk ret = ascii_validate_scalar(s + i, len - i);
+	UTF_STAT_SCALAR(ret.num_read);
+	ret.num_read += i;
+	return ret;
+}
+
+// a vector that starts with some ASCII is stored whole and the output moves on to its first byte
+// over 0x7F, the rest is encoded 16 bytes at a time
+template<class V>
+static UTF_Bulk latin1_to_utf8_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap) {
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t i = ret.num_read, room = cap - ret.num_written;
+		uint8_t *out = d + ret.num_written;
+
+		// a wide block that isn't ASCII goes 16 bytes at a time to its end, not back to the probe
+		size_t blocks = 1;
+		if(i + V::N <= len && room >= V::N) {
+			V in = V::load(s + i);
+			uint64_t m = in.mask();
+			size_t a = m ? ctz64(m) : static_cast<size_t>(V::N);
+			if(a >= 16) {
+				in.store(out);
+				ret.num_read += a;
+				ret.num_written += a;
+				continue;
+			}
+			blocks = V::N / 16;
+		}
+
+		// a lead and a continuation byte for every byte, the table keeps only the lead of ASCII
+		if(i + 16 <= len && room >= 32) {
+			for(; blocks && ret.num_read + 16 <= len && cap - ret.num_written >= 32; blocks--) {
+				__m128i in = load128(s + ret.num_read);
+				uint32_t m = static_cast<uint32_t>(_mm_movemask_epi8(in));
+				__m128i lead = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(in, 6), _mm_set1_epi8(0x03)), _mm_set1_epi8(static_cast<char>(0xC0)));
+				__m128i cont = _mm_or_si128(_mm_and_si128(in, _mm_set1_epi8(0x3F)), _mm_set1_epi8(static_cast<char>(0x80)));
+				lead = _mm_blendv_epi8(in, lead, in);
+				size_t n = utf_pack_latin1.len[m & 0xFF];
+				out = d + ret.num_written;
+				store128(out, _mm_shuffle_epi8(_mm_unpacklo_epi8(lead, cont), load128(utf_pack_latin1.shuf[m & 0xFF])));
+				store128(out + n, _mm_shuffle_epi8(_mm_unpackhi_epi8(lead, cont), load128(utf_pack_latin1.shuf[m >> 8])));
+				ret.num_written += n + utf_pack_latin1.len[m >> 8];
+				ret.num_read += 16;
+			}
+			continue;
+		}
+
+		if(!latin1_to_utf8_one(s, d, cap, &ret)) break;
+		UTF_STAT_SCALAR(1);
+	}
+	return ret;
+}
+
+template<class V>
+static UTF_Bulk latin1_to_utf16_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) {
+	size_t n = len < cap ? len : cap, i = 0;
+	for(; i + V::N <= n; i += V::N) V::load(s + i).widen16(d + i * 2, en);
+	UTF_Bulk ret = latin1_to_utf16_scalar(s + i, len - i, d + i * 2, cap - i, en);
+	UTF_STAT_SCALAR(ret.num_read);
+	ret.num_read += i;
+	ret.num_written += i;
+	return ret;
+}
+
+// converts the already validated [i, end), stops when out of room or before a codepoint over U+00FF
+template<class V>
+static size_t utf8_to_latin1_valid(const uint8_t *s, size_t i, size_t end, uint8_t *d, size_t *o, size_t cap, UTF_BOM) {
+	char32_t cp;
+	UTF_RESULT res;
+
+	while(i < end) {
+		size_t room = cap - *o;
+		uint8_t *out = d + *o;
+
+		if(i + V::N <= end && room >= V::N) {
+			V in = V::load(s + i);
+			uint64_t m = in.mask();
+			size_t a = m ? ctz64(m) : static_cast<size_t>(V::N);
+			if(a >= 16) {
+				in.store(out);
+				i += a;
+				*o += a;
+				continue;
+			}
+		}
+
+		// ASCII and the 2-byte sequences of U+0080 - U+00FF (leads 0xC2 and 0xC3), every lead gets its
+		// byte and the table drops the continuations, one in the last byte waits for the next window
+		if(i + 16 <= end && room >= 16) {
+			__m128i in = load128(s + i);
+			uint32_t multi = ge_mask(in, 0xC0);
+			if(!ge_mask(in, 0xC4)) {
+				uint32_t leads = utf8_lead_mask(in) & ~(multi & 0x8000);
+				__m128i two = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(in, _mm_set1_epi8(0x03)), 6),
+					_mm_and_si128(_mm_srli_si128(in, 1), _mm_set1_epi8(0x3F)));
+				__m128i x = _mm_blendv_epi8(in, two, _mm_cmpeq_epi8(_mm_max_epu8(in, _mm_set1_epi8(static_cast<char>(0xC0))), in));
+				size_t n = popcount32(leads & 0xFF);
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi8(x, _mm_loadl_epi64(reinterpret_cast<const __m128i *>(utf_pack8.shuf[leads & 0xFF]))));
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(out + n),
+					_mm_shuffle_epi8(_mm_srli_si128(x, 8), _mm_loadl_epi64(reinterpret_cast<const __m128i *>(utf_pack8.shuf[leads >> 8]))));
+				i += multi & 0x8000 ? 15 : 16;
+				*o += n + popcount32(leads >> 8);
+				continue;
+			}
+		}
+
+		uint8_t n = utf8_decode_n(s + i, end - i, &cp, &res);
+		if(cp > 0xFF || !room) break;
+		*out = static_cast<uint8_t>(cp);
+		i += n;
+		++*o;
+		UTF_STAT_SCALAR(n);
+	}
+	return i;
+}
+
+// utf8_convert_simd reports a stop before a codepoint over U+00FF as UTF_OUTPUT_FULL as well
+template<class V>
+static UTF_Bulk utf8_to_latin1_simd(const uint8_t *s, size_t len, uint8_t *d, size_t cap) {
+	UTF_Bulk ret = utf8_convert_simd<V, 1, utf8_to_latin1_valid<V>>(s, len, d, cap, UTF_LE);
+	if(ret.result == UTF_OUTPUT_FULL) {
+		char32_t cp;
+		UTF_RESULT res;
+		utf8_decode_n(s + ret.num_read, len - ret.num_read, &cp, &res);
+		if(cp > 0xFF) ret.result = UTF_ILLEGAL_CODEPOINT;
+	}
+	return ret;
+}
+
+template<class V>
+static size_t utf8_length_from_latin1_simd(const uint8_t *s, size_t len) {
+	size_t n = 0, i = 0;
+	for(; i + V::N <= len; i += V::N) n += popcount64(V::load(s + i).mask());
+	return n + i + utf8_length_from_latin1_scalar(s + i, len - i);
+}
+
+// offsets of the codepoints starting in the valid [i, end), at most room of them (out may be null to only count
+// them); the leads of 16 bytes are packed by the table and widened, returns where the first one not taken starts
+template<class V>
+static size_t utf8_lead_offsets(const uint8_t *s, size_t i, size_t end, uint32_t *out, size_t room, size_t *n) {
+	const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	size_t k = 0;
+	for(; i + 16 <= end && room - k >= 16; i += 16) {
+		uint32_t leads = utf8_lead_mask(load128(s + i));
+		if(!out) {
+			k += popcount32(leads);
+			continue;
+		}
+		__m128i base = _mm_set1_epi32(static_cast<int>(i));
+		if(leads == 0xFFFF) {
+			const __m128i step = _mm_setr_epi32(0, 1, 2, 3);
+			for(int q = 0; q < 4; q++) store128(reinterpret_cast<uint8_t *>(out + k + q * 4), _mm_add_epi32(base, _mm_add_epi32(step, _mm_set1_epi32(q * 4))));
+			k += 16;
+			continue;
+		}
+		for(int h = 0; h < 2; h++) {
+			uint32_t m = leads >> h * 8 & 0xFF;
+			__m128i pos = _mm_shuffle_epi8(h ? _mm_srli_si128(iota, 8) : iota, _mm_loadl_epi64(reinterpret_cast<const __m128i *>(utf_pack8.shuf[m])));
+			store128(reinterpret_cast<uint8_t *>(out + k), _mm_add_epi32(_mm_cvtepu8_epi32(pos), base));
+			store128(reinterpret_cast<uint8_t *>(out + k + 4), _mm_add_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(pos, 4)), base));
+			k += popcount32(m);
+		}
+	}
+	// the continuations at i belong to the last one counted
+	for(; i < end; i++) {
+		if((s[i] & 0xC0) == 0x80) continue;
+		if(k == room) break;
+		if(out) out[k] = static_cast<uint32_t>(i);
+		k++;
+	}
+	*n = k;
+	return i;
+}
+
+// valid stretches are validated a chunk at a time, decoded by the UTF-32 converter (native order on x86)
+// and the offsets packed from their lead bytes, the ill-formed subpart after one is an entry of its own
+template<class V>
+static UTF_Bulk utf8_decode_columns_simd(const uint8_t *s, size_t len, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t i = ret.num_read, o = ret.num_written, n = 0, end;
+		if(o == cap) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		size_t rest = input_bound(len - i, cap - o, UTF8);
+		UTF_Bulk v = utf8_validate_simd<V>(s + i, rest < UTF_CHUNK ? rest : static_cast<size_t>(UTF_CHUNK), len - i);
+
+		if(cps) {
+			size_t w = o;
+			end = utf8_to_utf32_valid<V>(s, i, i + v.num_read, reinterpret_cast<uint8_t *>(cps), &w, cap, UTF_LE);
+			if(offsets) utf8_lead_offsets<V>(s, i, end, offsets + o, w - o, &n);
+			n = w - o;
+		}
+		else end = utf8_lead_offsets<V>(s, i, i + v.num_read, offsets ? offsets + o : nullptr, cap - o, &n);
+		if(status) memset(status + o, UTF_OK, n);
+		ret.num_read = end;
+		ret.num_written += n;
+		if(end != i + v.num_read || v.result == UTF_OK) continue;
+
+		if(ret.num_written == cap) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		UTF_Cp c = utf::decoder<UTF8>::next(s + end, len - end);
+		if(cps) cps[ret.num_written] = c.codepoint;
+		if(offsets) offsets[ret.num_written] = static_cast<uint32_t>(end);
+		if(status) status[ret.num_written] = c.result;
+		ret.num_read += c.num_words;
+		ret.num_written++;
+		UTF_STAT_SCALAR(c.num_words);
+	}
+	return ret;
+}
+
+// the offsets of n words of size ws from word i, 4 at a time
+static inline void put_offsets(uint32_t *offsets, size_t i, size_t n, size_t ws) {
+	const int w = static_cast<int>(ws);
+	for(size_t k = 0; k < n; k += 4)
+		store128(reinterpret_cast<uint8_t *>(offsets + k), _mm_add_epi32(_mm_set1_epi32(static_cast<int>((i + k) * ws)), _mm_setr_epi32(0, w, 2 * w, 3 * w)));
+}
+
+// 8 words at a time like utf16_to_utf8_simd, the pairs put together by utf16_combine4 and the offsets
+// of the words kept moved along with them, runs of ASCII a vector at a time narrowed to bytes and
+// widened again; anything else is an entry of decode_columns_scalar's
+template<class V>
+static UTF_Bulk utf16_decode_columns_simd(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	const bool be = en == UTF_BE;
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t i = ret.num_read, o = ret.num_written;
+		if(i + 8 <= len && cap - o >= 8) {
+			__m128i in = load128(s + i * 2);
+			if(be) in = swap16(in);
+			__m128i top = _mm_and_si128(in, _mm_set1_epi16(static_cast<short>(0xFC00)));
+			uint32_t hi = mask16(_mm_cmpeq_epi16(top, _mm_set1_epi16(static_cast<short>(0xD800))));
+			uint32_t lo = mask16(_mm_cmpeq_epi16(top, _mm_set1_epi16(static_cast<short>(0xDC00))));
+
+			// four pairs, each of them a 32-bit lane
+			if(hi == 0x55 && lo == 0xAA) {
+				__m128i cp = _mm_add_epi32(_mm_or_si128(
+					_mm_slli_epi32(_mm_and_si128(in, _mm_set1_epi32(0x3FF)), 10),
+					_mm_and_si128(_mm_srli_epi32(in, 16), _mm_set1_epi32(0x3FF))), _mm_set1_epi32(0x10000));
+				if(cps) store128(reinterpret_cast<uint8_t *>(cps + o), cp);
+				if(offsets) store128(reinterpret_cast<uint8_t *>(offsets + o), _mm_add_epi32(_mm_set1_epi32(static_cast<int>(i * 2)), _mm_setr_epi32(0, 4, 8, 12)));
+				if(status) memset(status + o, UTF_OK, 4);
+				ret.num_read += 8;
+				ret.num_written += 4;
+				continue;
+			}
+
+			// every high surrogate followed by a low one, one in word 7 waits for the next window
+			if(!(((hi << 1) ^ lo) & 0xFF)) {
+				uint32_t keep = ~(lo | (hi & 0x80)) & 0xFF;
+				__m128i w0 = _mm_cvtepu16_epi32(in), w1 = _mm_cvtepu16_epi32(_mm_srli_si128(in, 8));
+				__m128i at0 = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(i * 2)), _mm_setr_epi32(0, 2, 4, 6));
+				__m128i at1 = _mm_add_epi32(at0, _mm_set1_epi32(8));
+				size_t n0 = 4, n1 = 4;
+				if(keep != 0xFF) {
+					w0 = utf16_combine4(w0, _mm_cvtepu16_epi32(_mm_srli_si128(in, 2)), keep & 0xF);
+					w1 = utf16_combine4(w1, _mm_cvtepu16_epi32(_mm_srli_si128(in, 10)), keep >> 4);
+					at0 = _mm_shuffle_epi8(at0, load128(utf_pack32.shuf[keep & 0xF]));
+					at1 = _mm_shuffle_epi8(at1, load128(utf_pack32.shuf[keep >> 4]));
+					n0 = popcount32(keep & 0xF);
+					n1 = popcount32(keep >> 4);
+				}
+				if(cps) {
+					store128(reinterpret_cast<uint8_t *>(cps + o), w0);
+					store128(reinterpret_cast<uint8_t *>(cps + o + n0), w1);
+				}
+				if(offsets) {
+					store128(reinterpret_cast<uint8_t *>(offsets + o), at0);
+					store128(reinterpret_cast<uint8_t *>(offsets + o + n0), at1);
+				}
+				if(status) memset(status + o, UTF_OK, n0 + n1);
+				ret.num_read += 8 - (hi >> 7);
+				ret.num_written += n0 + n1;
+				if(!_mm_testz_si128(in, _mm_set1_epi16(static_cast<short>(0xFF80)))) continue;
+
+				// more ASCII is likely to follow
+				while(ret.num_read + V::N <= len && cap - ret.num_written >= V::N) {
+					V a = V::load(s + ret.num_read * 2), b = V::load(s + ret.num_read * 2 + V::N);
+					if(be) {
+						a = a.swap16();
+						b = b.swap16();
+					}
+					if(!(a | b).is_ascii16()) break;
+					if(cps) {
+						uint8_t bytes[V::N];
+						V::narrow16(a, b, bytes);
+						V::load(bytes).widen32(reinterpret_cast<uint8_t *>(cps + ret.num_written), UTF_LE);
+					}
+					if(offsets) put_offsets(offsets + ret.num_written, ret.num_read, V::N, 2);
+					if(status) memset(status + ret.num_written, UTF_OK, V::N);
+					ret.num_read += V::N;
+					ret.num_written += V::N;
+				}
+				continue;
+			}
+		}
+
+		if(o == cap) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		UTF_Cp c = be ? utf::decoder<UTF16, UTF_BE>::next(s + i * 2, (len - i) * 2) : utf::decoder<UTF16, UTF_LE>::next(s + i * 2, (len - i) * 2);
+		if(cps) cps[o] = c.codepoint;
+		if(offsets) offsets[o] = static_cast<uint32_t>(i * 2);
+		if(status) status[o] = c.result;
+		ret.num_read += c.num_words;
+		ret.num_written++;
+		UTF_STAT_SCALAR(c.num_words * 2);
+	}
+	return ret;
+}
+
+// whole vectors of words that are codepoints as they are (swapped for BE), up to one that isn't when
+// there is one, which is an entry of decode_columns_scalar's
+template<class V>
+static UTF_Bulk utf32_decode_columns_simd(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	const size_t n = V::N / 4;
+	UTF_Bulk ret;
+	while(ret.num_read < len) {
+		size_t i = ret.num_read, o = ret.num_written;
+		if(i + n <= len && cap - o >= n) {
+			V in = V::load(s + i * 4);
+			if(en == UTF_BE) in = in.swap32();
+			uint64_t bad = in.invalid32_mask();
+			size_t good = bad ? ctz64(bad) : n;
+			if(cps) in.store(reinterpret_cast<uint8_t *>(cps + o));
+			if(offsets) put_offsets(offsets + o, i, good, 4);
+			if(status) memset(status + o, UTF_OK, good);
+			ret.num_read += good;
+			ret.num_written += good;
+			if(good == n) continue;
+		}
+
+		if(ret.num_written == cap) {
+			ret.result = UTF_OUTPUT_FULL;
+			break;
+		}
+		i = ret.num_read;
+		o = ret.num_written;
+		UTF_Cp c = en == UTF_BE ? utf::decoder<UTF32, UTF_BE>::next(s + i * 4, (len - i) * 4) : utf::decoder<UTF32, UTF_LE>::next(s + i * 4, (len - i) * 4);
+		if(cps) cps[o] = c.codepoint;
+		if(offsets) offsets[o] = static_cast<uint32_t>(i * 4);
+		if(status) status[o] = c.result;
+		ret.num_read += c.num_words;
+		ret.num_written++;
+		UTF_STAT_SCALAR(4);
+	}
+	return ret;
+}
+
+// V::N words from p as bytes if all of them are ASCII, in buf unless they're UTF-8 already
+template<class V>
+static inline const uint8_t *ascii_bytes(const uint8_t *p, UTF_TYPE type, UTF_BOM en, uint8_t *buf) {
+	if(type == UTF8) return V::load(p).is_ascii() ? p : nullptr;
+	if(type == UTF16) {
+		V a = V::load(p), b = V::load(p + V::N);
+		if(en == UTF_BE) {
+			a = a.swap16();
+			b = b.swap16();
+		}
+		if(!(a | b).is_ascii16()) return nullptr;
+		V::narrow16(a, b, buf);
+		return buf;
+	}
+	for(size_t k = 0; k < V::N; k += 16, p += 64) {
+		__m128i w0 = load128(p), w1 = load128(p + 16), w2 = load128(p + 32), w3 = load128(p + 48);
+		if(en == UTF_BE) {
+			w0 = swap32(w0);
+			w1 = swap32(w1);
+			w2 = swap32(w2);
+			w3 = swap32(w3);
+		}
+		if(!_mm_testz_si128(_mm_or_si128(_mm_or_si128(w0, w1), _mm_or_si128(w2, w3)), _mm_set1_epi32(~0x7F))) return nullptr;
+		store128(buf + k, _mm_packus_epi16(_mm_packus_epi32(w0, w1), _mm_packus_epi32(w2, w3)));
+	}
+	return buf;
+}
+
+// both sides a vector of words at a time as bytes, up to one where either isn't all ASCII or they differ
+template<class V>
+static size_t ascii_common_simd(const uint8_t *a, size_t len_a, UTF_TYPE type_a, UTF_BOM bom_a, const uint8_t *b, size_t len_b, UTF_TYPE type_b, UTF_BOM bom_b) {
+	const size_t wa = utf::word_size(type_a), wb = utf::word_size(type_b), len = len_a < len_b ? len_a : len_b;
+	uint8_t buf_a[V::N], buf_b[V::N];
+	size_t i = 0;
+	for(; i + V::N <= len; i += V::N) {
+		const uint8_t *x = ascii_bytes<V>(a + i * wa, type_a, bom_a, buf_a), *y = x ? ascii_bytes<V>(b + i * wb, type_b, bom_b, buf_b) : nullptr;
+		if(!y || (V::load(x) ^ V::load(y)).any()) break;
+	}
+	return i + ascii_common_scalar(a + i * wa, len_a - i, type_a, bom_a, b + i * wb, len_b - i, type_b, bom_b);
+}
+
+// hash_rounds_scalar with two lanes to a register, a pair of codepoints in memory is already the 64-bit
+// lane (little endian) and the multiply takes the low halves
+template<class V>
+static void hash_rounds_simd(uint64_t *acc, const char32_t *cps, size_t rounds, uint64_t key) {
+	const uint8_t *p = reinterpret_cast<const uint8_t *>(cps);
+	const __m128i step = _mm_set1_epi64x(static_cast<long long>(4 * HASH_K));
+	__m128i a0 = load128(reinterpret_cast<uint8_t *>(acc)), a1 = load128(reinterpret_cast<uint8_t *>(acc + 2));
+	__m128i k0 = _mm_set_epi64x(static_cast<long long>(key + HASH_K), static_cast<long long>(key));
+	__m128i k1 = _mm_set_epi64x(static_cast<long long>(key + 3 * HASH_K), static_cast<long long>(key + 2 * HASH_K));
+	for(size_t r = 0; r < rounds; r++, p += 32) {
+		__m128i v0 = load128(p), v1 = load128(p + 16);
+		__m128i x0 = _mm_xor_si128(v0, k0), x1 = _mm_xor_si128(v1, k1);
+		a0 = _mm_add_epi64(a0, _mm_add_epi64(_mm_mul_epu32(x0, _mm_srli_epi64(x0, 32)), _mm_shuffle_epi32(v0, _MM_SHUFFLE(1, 0, 3, 2))));
+		a1 = _mm_add_epi64(a1, _mm_add_epi64(_mm_mul_epu32(x1, _mm_srli_epi64(x1, 32)), _mm_shuffle_epi32(v1, _MM_SHUFFLE(1, 0, 3, 2))));
+		k0 = _mm_add_epi64(k0, step);
+		k1 = _mm_add_epi64(k1, step);
+	}
+	store128(reinterpret_cast<uint8_t *>(acc), a0);
+	store128(reinterpret_cast<uint8_t *>(acc + 2), a1);
+}
+
+// the first and the last byte of what's searched for against a whole vector each (Mula's
+// "SIMD-friendly algorithms for substring searching"), only where both match is it looked at closer
+template<class V>
+static size_t find_pair_simd(const uint8_t *s, size_t len, uint8_t a, uint8_t b, size_t dist) {
+	size_t p = 0;
+	for(; p + dist + V::N <= len; p += V::N) {
+		uint64_t m = V::load(s + p).eq_mask(a) & V::load(s + p + dist).eq_mask(b);
+		if(m) return p + ctz64(m);
+	}
+	for(; p + dist < len; p++)
+		if(s[p] == a && s[p + dist] == b) return p;
+	return len;
+}
+
+// the printable bytes of a vector up to its first one over 0x7F
+template<class V>
+static size_t ascii_width_simd(const uint8_t *s, size_t len, size_t *width) {
+	size_t i = 0;
+	for(; i + V::N <= len; i += V::N) {
+		V v = V::load(s + i);
+		uint64_t printable = v.ge_mask(0x20) & ~v.ge_mask(0x7F), high = v.mask();
+		if(high) {
+			*width += popcount64(printable & ((1ull << ctz64(high)) - 1));
+			return i + ctz64(high);
+		}
+		*width += popcount64(printable);
+	}
+	return i + ascii_width_scalar(s + i, len - i, width);
+}
+
+// the transcoders, only in SSE4.2: their non-ASCII blocks are 16 bytes in every set and the wider
+// ASCII probes fall through more often on mixed text, so with AVX2 and AVX-512 they measured slower
+#define UTF_TRANSCODERS \
+	UTF_FLATTEN static UTF_Bulk to_utf16(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) { \
+		return utf8_convert_simd<V, 2, utf8_to_utf16_valid<V>>(s, len, d, cap, en); \
+	} \
+	UTF_FLATTEN static UTF_Bulk from_utf16(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) { \
+		return utf16_to_utf8_simd<V>(s, len, d, cap, en); \
+	} \
+	UTF_FLATTEN static UTF_Bulk to_utf32(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) { \
+		return utf8_convert_simd<V, 4, utf8_to_utf32_valid<V>>(s, len, d, cap, en); \
+	} \
+	UTF_FLATTEN static UTF_Bulk from_utf32(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) { \
+		return utf32_to_utf8_simd(s, len, d, cap, en); \
+	}
+
+// entry points of one instruction set
+#define UTF_KERNELS(impl) \
+	UTF_FLATTEN static UTF_Bulk validate(const uint8_t *s, size_t len) { \
+		return utf8_validate_simd<V, true>(s, len, len); \
+	} \
+	UTF_FLATTEN static size_t count_codepoints(const uint8_t *s, size_t len) { \
+		return utf8_count_simd<V>(s, len, false); \
+	} \
+	UTF_FLATTEN static size_t utf16_length(const uint8_t *s, size_t len) { \
+		return utf8_count_simd<V>(s, len, true); \
+	} \
+	UTF_FLATTEN static size_t utf8_length16(const uint8_t *s, size_t len, UTF_BOM en) { \
+		return utf8_length_from_utf16_simd(s, len, en); \
+	} \
+	UTF_FLATTEN static size_t utf8_length32(const uint8_t *s, size_t len, UTF_BOM en) { \
+		return utf8_length_from_utf32_simd(s, len, en); \
+	} \
+	UTF_FLATTEN static UTF_Bulk swap16(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate) { \
+		return utf16_swap_simd<V>(s, len, d, cap, en, validate); \
+	} \
+	UTF_FLATTEN static UTF_Bulk swap32(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en, bool validate) { \
+		return utf32_swap_simd<V>(s, len, d, cap, en, validate); \
+	} \
+	UTF_FLATTEN static void detect_counts(const uint8_t *s, size_t len, size_t *c) { \
+		detect_counts_simd<V>(s, len, c); \
+	} \
+	UTF_FLATTEN static UTF_Bulk ascii_validate(const uint8_t *s, size_t len) { \
+		return ascii_validate_simd<V>(s, len); \
+	} \
+	UTF_FLATTEN static UTF_Bulk latin1_to_utf8(const uint8_t *s, size_t len, uint8_t *d, size_t cap) { \
+		return latin1_to_utf8_simd<V>(s, len, d, cap); \
+	} \
+	UTF_FLATTEN static UTF_Bulk latin1_to_utf16(const uint8_t *s, size_t len, uint8_t *d, size_t cap, UTF_BOM en) { \
+		return latin1_to_utf16_simd<V>(s, len, d, cap, en); \
+	} \
+	UTF_FLATTEN static UTF_Bulk utf8_to_latin1(const uint8_t *s, size_t len, uint8_t *d, size_t cap) { \
+		return utf8_to_latin1_simd<V>(s, len, d, cap); \
+	} \
+	UTF_FLATTEN static size_t utf8_length_latin1(const uint8_t *s, size_t len) { \
+		return utf8_length_from_latin1_simd<V>(s, len); \
+	} \
+	UTF_FLATTEN static UTF_Bulk decode_columns(const uint8_t *s, size_t len, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) { \
+		return utf8_decode_columns_simd<V>(s, len, cps, offsets, status, cap); \
+	} \
+	UTF_FLATTEN static UTF_Bulk decode_columns16(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) { \
+		return utf16_decode_columns_simd<V>(s, len, en, cps, offsets, status, cap); \
+	} \
+	UTF_FLATTEN static UTF_Bulk decode_columns32(const uint8_t *s, size_t len, UTF_BOM en, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) { \
+		return utf32_decode_columns_simd<V>(s, len, en, cps, offsets, status, cap); \
+	} \
+	UTF_FLATTEN static void hash_rounds(uint64_t *acc, const char32_t *cps, size_t rounds, uint64_t key) { \
+		hash_rounds_simd<V>(acc, cps, rounds, key); \
+	} \
+	UTF_FLATTEN static size_t find_pair(const uint8_t *s, size_t len, uint8_t a, uint8_t b, size_t dist) { \
+		return find_pair_simd<V>(s, len, a, b, dist); \
+	} \
+	UTF_FLATTEN static size_t ascii_width(const uint8_t *s, size_t len, size_t *width) { \
+		return ascii_width_simd<V>(s, len, width); \
+	} \
+	UTF_FLATTEN static size_t ascii_common(const uint8_t *a, size_t len_a, UTF_TYPE type_a, UTF_BOM bom_a, const uint8_t *b, size_t len_b, UTF_TYPE type_b, UTF_BOM bom_b) { \
+		return ascii_common_simd<V>(a, len_a, type_a, bom_a, b, len_b, type_b, bom_b); \
+	} \
+	static const utf_kernels kernels = { \
+		impl, validate, sse::to_utf16, sse::from_utf16, sse::to_utf32, sse::from_utf32, \
+		count_codepoints, utf16_length, utf8_length16, utf8_length32, swap16, swap32, detect_counts, \
+		ascii_validate, latin1_to_utf8, latin1_to_utf16, utf8_to_latin1, utf8_length_latin1, \
+		decode_columns, decode_columns16, decode_columns32, hash_rounds, find_pair, ascii_width, ascii_common \
+	};
+
+namespace sse {
+
+struct V {
+	__m128i v;
+	enum { N = 16 };
+
+	static V load(const uint8_t *p) { return { _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)) }; }
+	static V splat(uint8_t b) { return { _mm_set1_epi8(static_cast<char>(b)) }; }
+	static V table(const uint8_t *t) { return load(t); }
+
+	V operator|(V o) const { return { _mm_or_si128(v, o.v) }; }
+	V operator&(V o) const { return { _mm_and_si128(v, o.v) }; }
+	V operator^(V o) const { return { _mm_xor_si128(v, o.v) }; }
+
+	V shr4() const { return { _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F)) }; }
+	V lookup(V t) const { return { _mm_shuffle_epi8(t.v, v) }; }
+	V subs(V o) const { return { _mm_subs_epu8(v, o.v) }; }
+	template<int K> V prev(V p) const { return { _mm_alignr_epi8(v, p.v, 16 - K) }; }
+
+	bool any() const { return !_mm_testz_si128(v, v); }
+	bool is_ascii() const { return _mm_movemask_epi8(v) == 0; }
+	uint64_t mask() const { return static_cast<uint32_t>(_mm_movemask_epi8(v)); }
+	uint64_t cont_mask() const { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64)))); }
+	uint64_t ge_mask(uint8_t t) const {
+		return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8(static_cast<char>(t))), v)));
+	}
+	uint64_t eq_mask(uint8_t b) const { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(b))))); }
+
+	void widen16(uint8_t *d, UTF_BOM en) const {
+		__m128i lo = _mm_cvtepu8_epi16(v), hi = _mm_cvtepu8_epi16(_mm_srli_si128(v, 8));
+		if(en == UTF_BE) {
+			lo = _mm_slli_epi16(lo, 8);
+			hi = _mm_slli_epi16(hi, 8);
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(d), lo);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16), hi);
+	}
+	void widen32(uint8_t *d, UTF_BOM en) const {
+		__m128i w[4] = { _mm_cvtepu8_epi32(v), _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)),
+			_mm_cvtepu8_epi32(_mm_srli_si128(v, 8)), _mm_cvtepu8_epi32(_mm_srli_si128(v, 12)) };
+		for(int k = 0; k < 4; k++)
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(d + k * 16), en == UTF_BE ? _mm_slli_epi32(w[k], 24) : w[k]);
+	}
+
+	V swap16() const { return { _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)) }; }
+	bool is_ascii16() const { return _mm_testz_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80))) != 0; }
+	static void narrow16(V a, V b, uint8_t *d) { _mm_storeu_si128(reinterpret_cast<__m128i *>(d), _mm_packus_epi16(a.v, b.v)); }
+
+	void store(uint8_t *p) const { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+	V swap32() const { return { utf_detail::swap32(v) }; }
+	// 2 bits for every 16-bit word with (word & m) == x
+	uint64_t eq16_mask(uint16_t m, uint16_t x) const {
+		__m128i eq = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(m))), _mm_set1_epi16(static_cast<short>(x)));
+		return static_cast<uint32_t>(_mm_movemask_epi8(eq));
+	}
+	// bit per 32-bit word that isn't a codepoint
+	uint64_t invalid32_mask() const { return ~_mm_movemask_ps(_mm_castsi128_ps(utf32_valid4(v))) & 0xF; }
+};
+
+UTF_TRANSCODERS
+UTF_KERNELS(UTF_IMPL_SSE42)
+
+} // namespace sse
+
+UTF_TARGET_POP
+
+UTF_TARGET_PUSH("avx2,popcnt")
+namespace avx2 {
+
+struct V {
+	__m256i v;
+	enum { N = 32 };
+
+	// copying through memory keeps the calling convention the same for the generic code compiled
+	// for SSE4.2, it only matters when nothing gets inlined (-O0)
+	V(__m256i x) : v(x) {}
+	V(const V &o) : v(o.v) {}
+	V &operator=(const V &o) {
+		v = o.v;
+		return *this;
+	}
+
+	static V load(const uint8_t *p) { return { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)) }; }
+	static V splat(uint8_t b) { return { _mm256_set1_epi8(static_cast<char>(b)) }; }
+	static V table(const uint8_t *t) { return { _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(t))) }; }
+
+	V operator|(V o) const { return { _mm256_or_si256(v, o.v) }; }
+	V operator&(V o) const { return { _mm256_and_si256(v, o.v) }; }
+	V operator^(V o) const { return { _mm256_xor_si256(v, o.v) }; }
+
+	V shr4() const { return { _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F)) }; }
+	V lookup(V t) const { return { _mm256_shuffle_epi8(t.v, v) }; }
+	V subs(V o) const { return { _mm256_subs_epu8(v, o.v) }; }
+	template<int K> V prev(V p) const { return { _mm256_alignr_epi8(v, _mm256_permute2x128_si256(p.v, v, 0x21), 16 - K) }; }
+
+	bool any() const { return !_mm256_testz_si256(v, v); }
+	bool is_ascii() const { return _mm256_movemask_epi8(v) == 0; }
+	uint64_t mask() const { return static_cast<uint32_t>(_mm256_movemask_epi8(v)); }
+	uint64_t cont_mask() const { return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), v))); }
+	uint64_t ge_mask(uint8_t t) const {
+		return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(v, _mm256_set1_epi8(static_cast<char>(t))), v)));
+	}
+	uint64_t eq_mask(uint8_t b) const { return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(static_cast<char>(b))))); }
+
+	void widen16(uint8_t *d, UTF_BOM en) const {
+		__m256i lo = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)), hi = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1));
+		if(en == UTF_BE) {
+			lo = _mm256_slli_epi16(lo, 8);
+			hi = _mm256_slli_epi16(hi, 8);
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(d), lo);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(d + 32), hi);
+	}
+	void widen32(uint8_t *d, UTF_BOM en) const {
+		__m128i lo = _mm256_castsi256_si128(v), hi = _mm256_extracti128_si256(v, 1);
+		__m256i w[4] = { _mm256_cvtepu8_epi32(lo), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)),
+			_mm256_cvtepu8_epi32(hi), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)) };
+		for(int k = 0; k < 4; k++)
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(d + k * 32), en == UTF_BE ? _mm256_slli_epi32(w[k], 24) : w[k]);
+	}
+
+	V swap16() const { return { _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8)) }; }
+	bool is_ascii16() const { return _mm256_testz_si256(v, _mm256_set1_epi16(static_cast<short>(0xFF80))) != 0; }
+	static void narrow16(V a, V b, uint8_t *d) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(d), _mm256_permute4x64_epi64(_mm256_packus_epi16(a.v, b.v), 0xD8));
+	}
+
+	void store(uint8_t *p) const { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+	V swap32() const {
+		return { _mm256_shuffle_epi8(v, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+			3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)) };
+	}
+	uint64_t eq16_mask(uint16_t m, uint16_t x) const {
+		__m256i eq = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(static_cast<short>(m))), _mm256_set1_epi16(static_cast<short>(x)));
+		return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+	}
+	uint64_t invalid32_mask() const {
+		__m256i in_range = _mm256_cmpeq_epi32(_mm256_min_epu32(v, _mm256_set1_epi32(0x10FFFF)), v);
+		__m256i surrogate = _mm256_cmpeq_epi32(_mm256_and_si256(v, _mm256_set1_epi32(static_cast<int>(0xFFFFF800))), _mm256_set1_epi32(0xD800));
+		return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(surrogate, in_range))) & 0xFF;
+	}
+};
+
+UTF_KERNELS(UTF_IMPL_AVX2)
+
+} // namespace avx2
+UTF_TARGET_POP
+
+// GCC's own AVX-512 headers start some results from an uninitialized register (__Y = __Y), which
+// -Wmaybe-uninitialized reports in every kernel they're inlined into
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+UTF_TARGET_PUSH("avx512f,avx512bw,avx2,popcnt")
+namespace avx512 {
+
+struct V {
+	__m512i v;
+	enum { N = 64 };
+
+	// copying through memory keeps the calling convention the same for the generic code compiled
+	// for SSE4.2, it only matters when nothing gets inlined (-O0)
+	V(__m512i x) : v(x) {}
+	V(const V &o) : v(o.v) {}
+	V &operator=(const V &o) {
+		v = o.v;
+		return *this;
+	}
+
+	static V load(const uint8_t *p) { return { _mm512_loadu_si512(p) }; }
+	static V splat(uint8_t b) { return { _mm512_set1_epi8(static_cast<char>(b)) }; }
+	static V table(const uint8_t *t) { return { _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i *>(t))) }; }
+
+	V operator|(V o) const { return { _mm512_or_si512(v, o.v) }; }
+	V operator&(V o) const { return { _mm512_and_si512(v, o.v) }; }
+	V operator^(V o) const { return { _mm512_xor_si512(v, o.v) }; }
+
+	V shr4() const { return { _mm512_and_si512(_mm512_srli_epi16(v, 4), _mm512_set1_epi8(0x0F)) }; }
+	V lookup(V t) const { return { _mm512_shuffle_epi8(t.v, v) }; }
+	V subs(V o) const { return { _mm512_subs_epu8(v, o.v) }; }
+	template<int K> V prev(V p) const { return { _mm512_alignr_epi8(v, _mm512_alignr_epi64(v, p.v, 6), 16 - K) }; }
+
+	bool any() const { return _mm512_test_epi8_mask(v, v) != 0; }
+	bool is_ascii() const { return _mm512_movepi8_mask(v) == 0; }
+	uint64_t mask() const { return _mm512_movepi8_mask(v); }
+	uint64_t cont_mask() const { return _mm512_cmplt_epi8_mask(v, _mm512_set1_epi8(-64)); }
+	uint64_t ge_mask(uint8_t t) const { return _mm512_cmpge_epu8_mask(v, _mm512_set1_epi8(static_cast<char>(t))); }
+	uint64_t eq_mask(uint8_t b) const { return _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(static_cast<char>(b))); }
+
+	void widen16(uint8_t *d, UTF_BOM en) const {
+		__m512i lo = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(v)), hi = _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(v, 1));
+		if(en == UTF_BE) {
+			lo = _mm512_slli_epi16(lo, 8);
+			hi = _mm512_slli_epi16(hi, 8);
+		}
+		_mm512_storeu_si512(d, lo);
+		_mm512_storeu_si512(d + 64, hi);
+	}
+	void widen32(uint8_t *d, UTF_BOM en) const {
+		__m512i w[4] = { _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 0)), _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 1)),
+			_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 2)), _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 3)) };
+		for(int k = 0; k < 4; k++) _mm512_storeu_si512(d + k * 64, en == UTF_BE ? _mm512_slli_epi32(w[k], 24) : w[k]);
+	}
+
+	V swap16() const { return { _mm512_or_si512(_mm512_slli_epi16(v, 8), _mm512_srli_epi16(v, 8)) }; }
+	bool is_ascii16() const { return _mm512_test_epi16_mask(v, _mm512_set1_epi16(static_cast<short>(0xFF80))) == 0; }
+	static void narrow16(V a, V b, uint8_t *d) {
+		_mm512_storeu_si512(d, _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), _mm512_packus_epi16(a.v, b.v)));
+	}
+
+	void store(uint8_t *p) const { _mm512_storeu_si512(p, v); }
+	V swap32() const {
+		return { _mm512_shuffle_epi8(v, _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12))) };
+	}
+	uint64_t eq16_mask(uint16_t m, uint16_t x) const {
+		__mmask32 eq = _mm512_cmpeq_epi16_mask(_mm512_and_si512(v, _mm512_set1_epi16(static_cast<short>(m))), _mm512_set1_epi16(static_cast<short>(x)));
+		return _mm512_movepi8_mask(_mm512_movm_epi16(eq));
+	}
+	uint64_t invalid32_mask() const {
+		__mmask16 in_range = _mm512_cmple_epu32_mask(v, _mm512_set1_epi32(0x10FFFF));
+		__mmask16 surrogate = _mm512_cmpeq_epi32_mask(_mm512_and_si512(v, _mm512_set1_epi32(static_cast<int>(0xFFFFF800))), _mm512_set1_epi32(0xD800));
+		return (~in_range | surrogate) & 0xFFFF;
+	}
+};
+
+UTF_KERNELS(UTF_IMPL_AVX512)
+
+} // namespace avx512
+UTF_TARGET_POP
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#undef UTF_TRANSCODERS
+#undef UTF_KERNELS
+
+static inline void cpuid(unsigned leaf, unsigned r[4]) {
+#ifdef _MSC_VER
+	__cpuidex(reinterpret_cast<int *>(r), static_cast<int>(leaf), 0);
+#else
+	__cpuid_count(leaf, 0, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+// register state the OS saves on a context switch, only with OSXSAVE set
+static inline uint64_t xgetbv() {
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	uint32_t lo, hi;
+	__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return static_cast<uint64_t>(hi) << 32 | lo;
+#endif
+}
+
+#endif // UTF_SIMD
+
+static UTF_IMPL detect_impl() {
+#ifdef UTF_SIMD
+	unsigned r[4];
+	cpuid(0, r);
+	unsigned max_leaf = r[0];
+	cpuid(1, r);
+	unsigned ecx1 = r[2];
+
+	// ssse3, sse4.1, sse4.2, popcnt
+	if((ecx1 & 0x00980200) != 0x00980200) return UTF_IMPL_SCALAR;
+	// osxsave, avx and the OS saving ymm
+	if(max_leaf < 7 || (ecx1 & 0x18000000) != 0x18000000 || (xgetbv() & 0x06) != 0x06) return UTF_IMPL_SSE42;
+	cpuid(7, r);
+	if(!(r[1] & 0x20)) return UTF_IMPL_SSE42;
+	// avx512f, avx512bw and the OS saving zmm and the mask registers
+	if((r[1] & 0x40010000) != 0x40010000 || (xgetbv() & 0xE6) != 0xE6) return UTF_IMPL_AVX2;
+	return UTF_IMPL_AVX512;
+#else
+	return UTF_IMPL_SCALAR;
+#endif
+}
+
+static const utf_kernels *kernels_for(UTF_IMPL impl) {
+	switch(impl) {
+#ifdef UTF_SIMD
+		case UTF_IMPL_SSE42: return &sse::kernels;
+		case UTF_IMPL_AVX2: return &avx2::kernels;
+		case UTF_IMPL_AVX512: return &avx512::kernels;
+#endif
+		default: return &scalar::kernels;
+	}
+}
+
+static std::atomic<const utf_kernels *> active_kernels{ nullptr };
+
+static inline const utf_kernels *kernels() {
+	const utf_kernels *k = active_kernels.load(std::memory_order_acquire);
+	if(!k) {
+		// a utf_force_impl that got here first wins
+		const utf_kernels *best = kernels_for(utf_best_impl());
+		if(active_kernels.compare_exchange_strong(k, best)) k = best;
+	}
+	return k;
+}
+
+} // namespace utf_detail
+
+
+UTF_API UTF_IMPL utf_get_impl() {
+	return utf_detail::kernels()->impl;
+}
+
+UTF_API UTF_IMPL utf_best_impl() {
+	static const UTF_IMPL best = utf_detail::detect_impl();
+	return best;
+}
+
+UTF_API bool utf_force_impl(UTF_IMPL impl) {
+	if(impl == UTF_IMPL_AUTO) impl = utf_best_impl();
+	if(impl < UTF_IMPL_SCALAR || impl > utf_best_impl()) return false;
+	utf_detail::active_kernels.store(utf_detail::kernels_for(impl), std::memory_order_release);
+	return true;
+}
+
+UTF_API const char *utf_impl_name(UTF_IMPL impl) {
+	switch(impl) {
+		case UTF_IMPL_AUTO: return "auto";
+		case UTF_IMPL_SCALAR: return "scalar";
+		case UTF_IMPL_SSE42: return "sse4.2";
+		case UTF_IMPL_AVX2: return "avx2";
+		case UTF_IMPL_AVX512: return "avx512bw";
+		default: return "unknown";
+	}
+}
+
+
+UTF_API UTF_Bulk utf8_validate(const void *s, size_t len) {
+	return UTF_STAT_BULK(s, UTF8, UTF_LE, utf_detail::kernels()->validate(static_cast<const uint8_t *>(s), len));
+}
+
+UTF_API UTF_Bulk utf8_to_utf16(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en) {
+	return UTF_STAT_BULK(src, UTF8, en, utf_detail::kernels()->utf8_to_utf16(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap, en));
+}
+
+UTF_API UTF_Bulk utf16_to_utf8(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en) {
+	return UTF_STAT_BULK(src, UTF16, en, utf_detail::kernels()->utf16_to_utf8(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap, en));
+}
+
+UTF_API UTF_Bulk utf8_to_utf32(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en) {
+	return UTF_STAT_BULK(src, UTF8, en, utf_detail::kernels()->utf8_to_utf32(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap, en));
+}
+
+UTF_API UTF_Bulk utf32_to_utf8(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en) {
+	return UTF_STAT_BULK(src, UTF32, en, utf_detail::kernels()->utf32_to_utf8(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap, en));
+}
+
+UTF_API UTF_Bulk utf16_swap(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en, bool validate) {
+	return UTF_STAT_BULK(src, UTF16, en, utf_detail::kernels()->utf16_swap(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap, en, validate));
+}
+
+UTF_API UTF_Bulk utf32_swap(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en, bool validate) {
+	return UTF_STAT_BULK(src, UTF32, en, utf_detail::kernels()->utf32_swap(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap, en, validate));
+}
+
+UTF_API size_t utf8_count_codepoints(const void *src, size_t len) {
+	return utf_detail::kernels()->utf8_count_codepoints(static_cast<const uint8_t *>(src), len);
+}
+
+UTF_API size_t utf16_length_from_utf8(const void *src, size_t len) {
+	return utf_detail::kernels()->utf16_length_from_utf8(static_cast<const uint8_t *>(src), len);
+}
+
+UTF_API size_t utf8_length_from_utf16(const void *src, size_t len, UTF_BOM en) {
+	return utf_detail::kernels()->utf8_length_from_utf16(static_cast<const uint8_t *>(src), len, en);
+}
+
+UTF_API size_t utf8_length_from_utf32(const void *src, size_t len, UTF_BOM en) {
+	return utf_detail::kernels()->utf8_length_from_utf32(static_cast<const uint8_t *>(src), len, en);
+}
+
+UTF_API UTF_Bulk ascii_validate(const void *src, size_t len) {
+	return UTF_STAT_BULK(src, UTF8, UTF_LE, utf_detail::kernels()->ascii_validate(static_cast<const uint8_t *>(src), len));
+}
+
+UTF_API UTF_Bulk latin1_to_utf8(const void *src, size_t len, void *dst, size_t cap) {
+	return UTF_STAT_BULK(src, utf_detail::STAT_LATIN1, UTF_LE, utf_detail::kernels()->latin1_to_utf8(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap));
+}
+
+UTF_API UTF_Bulk latin1_to_utf16(const void *src, size_t len, void *dst, size_t cap, UTF_BOM en) {
+	return UTF_STAT_BULK(src, utf_detail::STAT_LATIN1, UTF_LE, utf_detail::kernels()->latin1_to_utf16(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap, en));
+}
+
+UTF_API UTF_Bulk utf8_to_latin1(const void *src, size_t len, void *dst, size_t cap) {
+	return UTF_STAT_BULK(src, UTF8, UTF_LE, utf_detail::kernels()->utf8_to_latin1(static_cast<const uint8_t *>(src), len, static_cast<uint8_t *>(dst), cap));
+}
+
+UTF_API size_t utf8_length_from_latin1(const void *src, size_t len) {
+	return utf_detail::kernels()->utf8_length_from_latin1(static_cast<const uint8_t *>(src), len);
+}
+
+UTF_API size_t utf8_boundary(const void *stream_beg, size_t len, size_t n) {
+	const uint8_t *s = static_cast<const uint8_t *>(stream_beg);
+	if(n >= len) return len;
+	if(n < 4) {
+		for(size_t i = n; i > 0; i--)
+			if((s[i] & 0xC0) != 0x80) return i;
+		return 0;
+	}
+	// s[n] and the 3 bytes before it in one load, nearest first; a sequence starts at every byte
+	// that isn't a continuation, and if none of them does the text is broken there anyway
+	uint32_t x = utf_detail::get32(s + n - 3, UTF_BE);
+	uint32_t starts = ~(x & ~(x << 1)) & 0x80808080;
+	return starts ? n - utf_detail::ctz64(starts) / 8 : n;
+}
+
+UTF_API size_t utf16_boundary(const void *stream_beg, size_t len, size_t n, UTF_BOM en) {
+	const uint8_t *s = static_cast<const uint8_t *>(stream_beg);
+	if(n >= len) return len;
+	bool low = (utf_detail::get16(s + n * 2, en) & 0xFC00) == 0xDC00;
+	return low && n > 0 && (utf_detail::get16(s + n * 2 - 2, en) & 0xFC00) == 0xD800 ? n - 1 : n;
+}
+
+UTF_API UTF_Bulk utf_transcode(const void *src, size_t len, UTF_TYPE from, UTF_BOM from_bom, void *dst, size_t cap, UTF_TYPE to, UTF_BOM to_bom) {
+	const uint8_t *s = static_cast<const uint8_t *>(src);
+	uint8_t *d = static_cast<uint8_t *>(dst);
+
+	if(from == UTF8 && to == UTF16) return utf8_to_utf16(s, len, d, cap, to_bom);
+	if(from == UTF16 && to == UTF8) return utf16_to_utf8(s, len, d, cap, from_bom);
+	if(from == UTF8 && to == UTF32) return utf8_to_utf32(s, len, d, cap, to_bom);
+	if(from == UTF32 && to == UTF8) return utf32_to_utf8(s, len, d, cap, from_bom);
+	if(from == UTF16 && to == UTF16 && from_bom != to_bom) return utf16_swap(s, len, d, cap, from_bom, true);
+	if(from == UTF32 && to == UTF32 && from_bom != to_bom) return utf32_swap(s, len, d, cap, from_bom, true);
+
+	if(from == UTF8 && to == UTF8) {
+		// a sequence cut off at cap is only known to be valid once there's room for it
+		size_t n = len < cap ? len : cap;
+		UTF_Bulk ret = utf8_validate(s, n);
+		if(ret.result == UTF_TOO_FEW_WORDS && n < len) {
+			char32_t cp;
+			UTF_RESULT res;
+			bool incomplete;
+			utf_detail::decode_any_n(s + ret.num_read, n - ret.num_read, UTF8, UTF_LE, &cp, &res, &incomplete);
+			if(incomplete) ret.result = UTF_OUTPUT_FULL;
+		}
+		else if(ret.result == UTF_OK && n < len) ret.result = UTF_OUTPUT_FULL;
+		memcpy(d, s, ret.num_read);
+		ret.num_written = ret.num_read;
+		return ret;
+	}
+
+	return UTF_STAT_BULK(s, from, from_bom, utf_detail::transcode_scalar(s, len, from, from_bom, d, cap, to, to_bom));
+}
+
+
+UTF_API UTF_Stream utf_stream(UTF_TYPE from, UTF_BOM from_bom, UTF_TYPE to, UTF_BOM to_bom) {
+	UTF_Stream st;
+	st.from = from;
+	st.from_bom = from_bom;
+	st.to = to;
+	st.to_bom = to_bom;
+	return st;
+}
+
+UTF_API UTF_Bulk utf_stream_write(UTF_Stream *st, const void *chunk, size_t len, void *dst, size_t cap) {
+	const uint8_t *s = static_cast<const uint8_t *>(chunk);
+	uint8_t *d = static_cast<uint8_t *>(dst);
+	const size_t ws_from = utf_detail::word_size(st->from), ws_to = utf_detail::word_size(st->to);
+	char32_t cp;
+	UTF_RESULT res;
+	bool incomplete;
+
+	UTF_Bulk ret;
+	ret.result = st->result;
+	if(st->result != UTF_OK) return ret;
+
+	// first the sequence started in an earlier chunk
+	if(st->num_pending) {
+		uint8_t seq[16];
+		size_t np = st->num_pending, k = len < sizeof(seq) - np ? len : sizeof(seq) - np;
+		memcpy(seq, st->pending, np);
+		memcpy(seq + np, s, k);
+
+		size_t n = utf_detail::decode_any_n(seq, np + k, st->from, st->from_bom, &cp, &res, &incomplete);
+		if(incomplete) {
+			memcpy(st->pending + np, s, len);
+			st->num_pending = static_cast<uint8_t>(np + len);
+			ret.num_read = len;
+			return ret;
+		}
+		if(res != UTF_OK) {
+			st->result = ret.result = res;
+			return ret;
+		}
+		size_t w = utf_detail::put_any(d, cap, cp, st->to, st->to_bom);
+		if(!w) {
+			ret.result = UTF_OUTPUT_FULL;
+			return ret;
+		}
+		st->num_pending = 0;
+		ret.num_read = n - np;
+		ret.num_written = w;
+	}
+
+	// the rest straight from chunk to dst
+	UTF_Bulk b = utf_transcode(s + ret.num_read, (len - ret.num_read) / ws_from, st->from, st->from_bom,
+		d + ret.num_written * ws_to, cap - ret.num_written, st->to, st->to_bom);
+	ret.num_read += b.num_read * ws_from;
+	ret.num_written += b.num_written;
+
+	if(b.result == UTF_OUTPUT_FULL) {
+		ret.result = UTF_OUTPUT_FULL;
+		return ret;
+	}
+	if(b.result != UTF_OK) {
+		utf_detail::decode_any_n(s + ret.num_read, len - ret.num_read, st->from, st->from_bom, &cp, &res, &incomplete);
+		if(!incomplete) {
+			st->result = ret.result = b.result;
+			return ret;
+		}
+	}
+
+	// whatever is left can't make a whole sequence yet
+	st->num_pending = static_cast<uint8_t>(len - ret.num_read);
+	memcpy(st->pending, s + ret.num_read, st->num_pending);
+	ret.num_read = len;
+	return ret;
+}
+
+UTF_API UTF_RESULT utf_stream_end(UTF_Stream *st) {
+	if(st->result == UTF_OK && st->num_pending) st->result = UTF_TOO_FEW_WORDS;
+	return st->result;
+}
+
+
+namespace utf_detail {
+
+// words of the maximal ill-formed subpart at s (at least one) and what's wrong with it, s is
+// where a transcoder stopped
+static inline size_t invalid_words(const uint8_t *s, size_t len, UTF_TYPE t, UTF_BOM en, UTF_RESULT *res) {
+	UTF_Cp c;
+	if(t == UTF8) c = utf::decoder<UTF8>::next(s, len);
+	else if(t == UTF16) c = en == UTF_BE ? utf::decoder<UTF16, UTF_BE>::next(s, len * 2) : utf::decoder<UTF16, UTF_LE>::next(s, len * 2);
+	else c = en == UTF_BE ? utf::decoder<UTF32, UTF_BE>::next(s, len * 4) : utf::decoder<UTF32, UTF_LE>::next(s, len * 4);
+	*res = static_cast<UTF_RESULT>(c.result);
+	return c.num_words;
+}
+
+// moves a split point off the middle of a sequence, at most 3 continuation bytes or one low surrogate
+// (more than that is invalid anyway, and the error is found in whichever part it ends up)
+static inline size_t resync(const uint8_t *s, size_t len, size_t i, UTF_TYPE t, UTF_BOM en) {
+	if(t == UTF8) for(int k = 0; k < 3 && i < len && (s[i] & 0xC0) == 0x80; k++) i++;
+	else if(t == UTF16 && i < len && (get16(s + i * 2, en) & 0xFC00) == 0xDC00) i++;
+	return i;
+}
+
+// words utf_transcode writes, same rules as the length functions
+static inline size_t transcoded_length(const uint8_t *s, size_t len, UTF_TYPE from, UTF_BOM from_bom, UTF_TYPE to) {
+	if(from == to) return len;
+	if(from == UTF8) return to == UTF16 ? utf16_length_from_utf8(s, len) : utf8_count_codepoints(s, len);
+	if(to == UTF8) return from == UTF16 ? utf8_length_from_utf16(s, len, from_bom) : utf8_length_from_utf32(s, len, from_bom);
+
+	size_t n = len;
+	if(from == UTF16) for(size_t i = 0; i < len; i++) n -= (get16(s + i * 2, from_bom) & 0xFC00) == 0xDC00;
+	else for(size_t i = 0; i < len; i++) n += get32(s + i * 4, from_bom) >= 0x10000;
+	return n;
+}
+
+#ifndef UTF_NO_THREADS
+// fn(0) .. fn(n - 1) on num_threads threads, the calling one included
+template<class Fn>
+static void parallel_for(size_t n, unsigned num_threads, Fn fn) {
+	std::atomic<size_t> next{ 0 };
+	auto work = [&] {
+		for(size_t i; (i = next++) < n;) fn(i);
+	};
+	std::vector<std::thread> pool;
+	for(unsigned t = 1; t < num_threads; t++) pool.emplace_back(work);
+	work();
+	for(auto &t : pool) t.join();
+}
+#endif
+
+} // namespace utf_detail
+
+UTF_API UTF_Bulk utf_transcode_parallel(const void *src, size_t len, UTF_TYPE from, UTF_BOM from_bom, void *dst, size_t cap, UTF_TYPE to, UTF_BOM to_bom, unsigned num_threads) {
+#ifndef UTF_NO_THREADS
+	using namespace utf_detail;
+	const uint8_t *s = static_cast<const uint8_t *>(src);
+	uint8_t *d = static_cast<uint8_t *>(dst);
+	size_t ws_from = word_size(from), ws_to = word_size(to);
+	// the lengths of the parts are found first, only for what can fit
+	len = input_bound(len, cap, from);
+
+	if(!num_threads) num_threads = std::thread::hardware_concurrency();
+	if(num_threads > len * ws_from / UTF_PARALLEL_MIN) num_threads = static_cast<unsigned>(len * ws_from / UTF_PARALLEL_MIN);
+	if(num_threads < 2) return utf_transcode(src, len, from, from_bom, dst, cap, to, to_bom);
+
+	// a few parts per thread so a slow one doesn't hold up the rest
+	size_t n = num_threads * 4;
+	std::vector<size_t> beg(n + 1), out(n + 1);
+	std::vector<UTF_Bulk> res(n);
+	beg[n] = len;
+	for(size_t i = 1; i < n; i++) {
+		size_t at = resync(s, len, len / n * i, from, from_bom);
+		beg[i] = at > beg[i - 1] ? at : beg[i - 1];
+	}
+
+	// where each part goes in dst
+	parallel_for(n, num_threads, [&](size_t i) {
+		out[i + 1] = transcoded_length(s + beg[i] * ws_from, beg[i + 1] - beg[i], from, from_bom, to);
+	});
+	for(size_t i = 0; i < n; i++) out[i + 1] += out[i];
+
+	parallel_for(n, num_threads, [&](size_t i) {
+		size_t room = out[i] < cap ? cap - out[i] : 0;
+		if(room > out[i + 1] - out[i]) room = out[i + 1] - out[i];
+		res[i] = utf_transcode(s + beg[i] * ws_from, beg[i + 1] - beg[i], from, from_bom, d + out[i] * ws_to, room, to, to_bom);
+	});
+
+	// everything before the first part that stopped went through whole
+	UTF_Bulk ret;
+	for(size_t i = 0; i < n; i++) {
+		ret.num_read = beg[i] + res[i].num_read;
+		ret.num_written = out[i] + res[i].num_written;
+		if(res[i].result != UTF_OK) {
+			ret.result = res[i].result;
+			break;
+		}
+	}
+	return ret;
+#else
+	(void)num_threads;
+	return utf_transcode(src, len, from, from_bom, dst, cap, to, to_bom);
+#endif
+}
+
+UTF_API UTF_Bulk utf_transcode_lossy(const void *src, size_t len, UTF_TYPE from, UTF_BOM from_bom, void *dst, size_t cap, UTF_TYPE to, UTF_BOM to_bom, UTF_Errors *errors) {
+	using namespace utf_detail;
+	const uint8_t *s = static_cast<const uint8_t *>(src);
+	uint8_t *d = static_cast<uint8_t *>(dst);
+	size_t ws_from = word_size(from), ws_to = word_size(to);
+
+	// the fast path up to the next error, patch it, and again
+	UTF_Bulk ret;
+	for(;;) {
+		UTF_Bulk b = utf_transcode(s + ret.num_read * ws_from, len - ret.num_read, from, from_bom,
+			d + ret.num_written * ws_to, cap - ret.num_written, to, to_bom);
+		ret.num_read += b.num_read;
+		ret.num_written += b.num_written;
+		if(b.result == UTF_OK || b.result == UTF_OUTPUT_FULL) {
+			ret.result = b.result;
+			return ret;
+		}
+
+		UTF_RESULT res;
+		size_t n = invalid_words(s + ret.num_read * ws_from, len - ret.num_read, from, from_bom, &res);
+		size_t w = put_any(d + ret.num_written * ws_to, cap - ret.num_written, 0xFFFD, to, to_bom);
+		if(!w) {
+			ret.result = UTF_OUTPUT_FULL;
+			return ret;
+		}
+		ret.num_read += n;
+		ret.num_written += w;
+		if(errors) errors->count[res]++;
+	}
+}
+
+UTF_API UTF_Bulk utf_decode_columns(const void *src, size_t len, UTF_TYPE type, UTF_BOM bom, char32_t *cps, uint32_t *offsets, uint8_t *status, size_t cap) {
+	using namespace utf_detail;
+	const uint8_t *s = static_cast<const uint8_t *>(src);
+	// stop at the last sequence that starts within 4 GiB
+	const size_t max_words = static_cast<size_t>(UINT32_MAX) / word_size(type);
+	bool cut = offsets && len > max_words;
+	if(cut) len = type == UTF8 ? utf8_boundary(s, len, max_words) : type == UTF16 ? utf16_boundary(s, len, max_words, bom) : max_words;
+
+	const utf_kernels *k = kernels();
+	UTF_Bulk ret = UTF_STAT_BULK(s, type, bom,
+		type == UTF8 ? k->utf8_decode_columns(s, len, cps, offsets, status, cap) :
+		type == UTF16 ? k->utf16_decode_columns(s, len, bom, cps, offsets, status, cap) :
+		k->utf32_decode_columns(s, len, bom, cps, offsets, status, cap));
+	if(cut && ret.result == UTF_OK) ret.result = UTF_OUTPUT_FULL;
+	return ret;
+}
+
+namespace utf_detail {
+
+// the codepoints of a text a block at a time through the kernels, ill-formed subparts as U+FFFD like
+// utf_transcode_lossy; every block but the last is full
+struct cp_blocks {
+	enum { N = 256 };
+	const uint8_t *s;
+	size_t len, pos = 0, n = 0;
+	UTF_TYPE type;
+	UTF_BOM bom;
+	char32_t cps[N];
+
+	cp_blocks(const void *src, size_t len, UTF_TYPE type, UTF_BOM bom) : s(static_cast<const uint8_t *>(src)), len(len), type(type), bom(bom) {}
+
+	const uint8_t *at() const { return s + pos * word_size(type); }
+
+	bool fill(size_t cap = N) {
+		const utf_kernels *k = kernels();
+		UTF_Bulk b = type == UTF8 ? k->utf8_decode_columns(at(), len - pos, cps, nullptr, nullptr, cap) :
+			type == UTF16 ? k->utf16_decode_columns(at(), len - pos, bom, cps, nullptr, nullptr, cap) :
+			k->utf32_decode_columns(at(), len - pos, bom, cps, nullptr, nullptr, cap);
+		pos += b.num_read;
+		n = b.num_written;
+		return n > 0;
+	}
+};
+
+// word i starts no sequence, it continues the one before it
+static inline bool continues(const uint8_t *s, size_t i, UTF_TYPE type, UTF_BOM bom) {
+	if(type == UTF8) return (s[i] & 0xC0) == 0x80;
+	return type == UTF16 && (get16(s + i * 2, bom) & 0xFC00) == 0xDC00;
+}
+
+// the well-formed codepoints a text starts with in the words of another encoding, by the kernel that
+// does that in one step; no words when there is none (UTF-16 and UTF-32 to each other)
+static inline UTF_Bulk words_as(const uint8_t *s, size_t len, UTF_TYPE from, UTF_BOM from_bom, uint8_t *d, size_t cap, UTF_TYPE to, UTF_BOM to_bom) {
+	const utf_kernels *k = kernels();
+	if(from == UTF8 && to == UTF16) return k->utf8_to_utf16(s, len, d, cap, to_bom);
+	if(from == UTF8 && to == UTF32) return k->utf8_to_utf32(s, len, d, cap, to_bom);
+	if(from == UTF16 && to == UTF16) return k->utf16_swap(s, len, d, cap, from_bom, true);
+	if(from == UTF32 && to == UTF32) return k->utf32_swap(s, len, d, cap, from_bom, true);
+	return UTF_Bulk();
+}
+
+static inline uint64_t hash_fmix(uint64_t h) {
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDull;
+	h ^= h >> 33;
+	h *= 0xC4CEB9FE1A85EC53ull;
+	return h ^ h >> 33;
+}
+
+// after every block, so whole blocks can't trade places
+static inline void hash_scramble(uint64_t *acc, uint64_t seed) {
+	for(int j = 0; j < 4; j++) {
+		acc[j] ^= acc[j] >> 47 ^ seed;
+		acc[j] *= 0x9E3779B1u;
+	}
+}
+
+} // namespace utf_detail
+
+UTF_API int utf_compare(const void *a, size_t len_a, UTF_TYPE type_a, UTF_BOM bom_a, const void *b, size_t len_b, UTF_TYPE type_b, UTF_BOM bom_b) {
+	using namespace utf_detail;
+	const uint8_t *sa = static_cast<const uint8_t *>(a), *sb = static_cast<const uint8_t *>(b);
+
+	// in the same encoding the identical words up front are the same codepoints, up to the last one that
+	// starts a sequence in both or ends the text (a sequence going on past it would read different words)
+	size_t skip = 0;
+	if(type_a == type_b && (bom_a == bom_b || type_a == UTF8)) {
+		const size_t ws = word_size(type_a), bytes = (len_a < len_b ? len_a : len_b) * ws;
+		size_t m = 0;
+		for(; m + 64 <= bytes && !memcmp(sa + m, sb + m, 64); m += 64);
+		for(; m < bytes && sa[m] == sb[m]; m++);
+		for(skip = m / ws; skip > 0; skip--)
+			if((skip == len_a || !continues(sa, skip, type_a, bom_a)) && (skip == len_b || !continues(sb, skip, type_b, bom_b))) break;
+		if(m == bytes && len_a == len_b) return 0;
+	}
+
+	cp_blocks x(sa + skip * word_size(type_a), len_a - skip, type_a, bom_a), y(sb + skip * word_size(type_b), len_b - skip, type_b, bom_b);
+	// in different encodings one side may be turned into the words of the other, UTF-8 into UTF-16 or
+	// UTF-32, or UTF-16 / UTF-32 into the other byte order
+	cp_blocks *from = type_a == UTF8 || (type_a == type_b && bom_a != bom_b) ? &x : &y, *to = from == &x ? &y : &x;
+	const bool as_words = type_a != type_b ? from->type == UTF8 : bom_a != bom_b && type_a != UTF8;
+	uint8_t words[4096];
+	const size_t ws = word_size(to->type);
+
+	const utf_kernels *k = kernels();
+	size_t i = 0, j = 0;
+	for(;;) {
+		// both blocks are used up at once unless a text ends; ASCII on both sides is compared as it is,
+		// then as many words as are the same once one side is in the other's encoding; codepoints are
+		// decoded where they aren't, only a few after a long run of either at an ill-formed one
+		if(i == x.n && j == y.n) {
+			size_t m = k->ascii_common(x.at(), x.len - x.pos, type_a, bom_a, y.at(), y.len - y.pos, type_b, bom_b), same = 0;
+			x.pos += m;
+			y.pos += m;
+			// no more than there's room for, one word never takes more than one of the other encoding's
+			for(const size_t cap = sizeof(words) / ws; as_words;) {
+				size_t n = from->len - from->pos < cap ? from->len - from->pos : cap;
+				UTF_Bulk w = words_as(from->at(), n, from->type, from->bom, words, cap, to->type, to->bom);
+				if(!w.num_written || w.num_written > to->len - to->pos || memcmp(words, to->at(), w.num_written * ws)) break;
+				from->pos += w.num_read;
+				to->pos += w.num_written;
+				same += w.num_written;
+			}
+			const bool few = m >= 16 || same >= cp_blocks::N;
+			x.fill(few ? 16 : cp_blocks::N);
+			y.fill(few ? 16 : cp_blocks::N);
+			i = j = 0;
+		}
+		if(i == x.n) {
+			x.fill();
+			i = 0;
+		}
+		if(j == y.n) {
+			y.fill();
+			j = 0;
+		}
+		if(!x.n || !y.n) return (x.n > 0) - (y.n > 0);
+
+		size_t m = x.n - i < y.n - j ? x.n - i : y.n - j;
+		if(!memcmp(x.cps + i, y.cps + j, m * sizeof(char32_t))) {
+			i += m;
+			j += m;
+			continue;
+		}
+		for(; x.cps[i] == y.cps[j]; i++, j++);
+		return x.cps[i] < y.cps[j] ? -1 : 1;
+	}
+}
+
+UTF_API uint64_t utf_hash(const void *src, size_t len, UTF_TYPE type, UTF_BOM bom, uint64_t seed) {
+	using namespace utf_detail;
+	uint64_t acc[4] = { seed, seed ^ HASH_K, seed + HASH_K, seed - HASH_K }, count = 0;
+	cp_blocks in(src, len, type, bom);
+	while(in.fill()) {
+		size_t i = in.n / 8 * 8;
+		kernels()->hash_rounds(acc, in.cps, i / 8, seed);
+		// only the last block has a rest, the count tells the zeros it's padded with from text
+		if(i < in.n) {
+			char32_t rest[8] = { 0 };
+			memcpy(rest, in.cps + i, (in.n - i) * sizeof(char32_t));
+			hash_rounds_scalar(acc, rest, 1, seed + i / 2 * HASH_K);
+		}
+		hash_scramble(acc, seed);
+		count += in.n;
+	}
+	uint64_t ret = hash_fmix(count ^ seed);
+	for(uint64_t lane : acc) ret = hash_fmix(ret ^ lane);
+	return ret;
+}
+
+namespace utf_detail {
+
+// codepoints in the first len words, an ill-formed subpart counting as one like U+FFFD
+static size_t count_lossy(const uint8_t *s, size_t len, UTF_TYPE type, UTF_BOM bom) {
+	if(type == UTF32) return len;
+	size_t n = len;
+	if(type == UTF16) {
+		// a pair is one
+		for(size_t i = 1; i < len; i++)
+			if((get16(s + i * 2, bom) & 0xFC00) == 0xDC00 && (get16(s + i * 2 - 2, bom) & 0xFC00) == 0xD800) n--;
+		return n;
+	}
+	const utf_kernels *k = kernels();
+	n = 0;
+	for(size_t i = 0; i < len; n++) {
+		UTF_Bulk b = k->validate(s + i, len - i);
+		n += k->utf8_count_codepoints(s + i, b.num_read);
+		i += b.num_read;
+		if(b.result == UTF_OK) break;
+		i += utf::decoder<UTF8>::next(s + i, len - i).num_words;
+	}
+	return n;
+}
+
+} // namespace utf_detail
+
+UTF_API UTF_Found utf_find(const void *text, size_t len, UTF_TYPE type, UTF_BOM bom, const char32_t *needle, size_t needle_len) {
+	using namespace utf_detail;
+	const uint8_t *s = static_cast<const uint8_t *>(text);
+	const size_t ws = word_size(type), bytes = len * ws, low = bom == UTF_BE ? ws - 1 : 0;
+	UTF_Found ret;
+	if(!needle_len) {
+		ret.found = true;
+		return ret;
+	}
+
+	// the needle once, as much as fits here, the rest only once that much matched
+	uint8_t head[64];
+	size_t head_len = 0, head_cps = 0, need = 0;
+	UTF_Point last;
+	for(size_t i = 0; i < needle_len; i++) {
+		last = utf_encode(needle[i], type, bom);
+		if(last.result != UTF_OK) return ret;
+		if(head_cps == i && head_len + last.num_bytes <= sizeof(head)) {
+			memcpy(head + head_len, last.bytes, last.num_bytes);
+			head_len += last.num_bytes;
+			head_cps++;
+		}
+		need += last.num_bytes;
+	}
+	if(need > bytes) return ret;
+
+	// the low byte of the first and of the last word, the high ones are mostly 0 in UTF-16 and UTF-32
+	const uint8_t a = head[low], b = last.bytes[last.num_bytes - ws + low];
+	const size_t dist = need - ws;
+	const utf_kernels *k = kernels();
+	for(size_t from = low; from + dist < bytes;) {
+		size_t p = from + k->find_pair(s + from, bytes - from, a, b, dist);
+		if(p + dist >= bytes) break;
+		from = p + 1;
+		size_t at = p - low;
+		if(at % ws || memcmp(s + at, head, head_len)) continue;
+
+		size_t pos = at + head_len, i = head_cps;
+		for(; i < needle_len; i++) {
+			UTF_Point e = utf_encode(needle[i], type, bom);
+			if(memcmp(s + pos, e.bytes, e.num_bytes)) break;
+			pos += e.num_bytes;
+		}
+		if(i < needle_len) continue;
+
+		ret.found = true;
+		ret.byte = at;
+		ret.codepoint = count_lossy(s, at / ws, type, bom);
+		return ret;
+	}
+	return ret;
+}
+
+UTF_API UTF_Found utf_find_codepoint(const void *text, size_t len, UTF_TYPE type, UTF_BOM bom, char32_t cp) {
+	return utf_find(text, len, type, bom, &cp, 1);
+}
+
+
+namespace utf_detail {
+
+// one codepoint of units16 UTF-16 units starting at byte pos, with an entry first if one is due
+static inline bool index_add(UTF_Index *ix, uint64_t pos, unsigned units16) {
+	if(ix->num_codepoints == static_cast<uint64_t>(ix->num_entries) * ix->step) {
+		if(ix->num_entries == ix->cap) return false;
+		ix->entries[ix->num_entries].byte = pos;
+		ix->entries[ix->num_entries++].unit16 = ix->num_units16;
+	}
+	ix->num_codepoints++;
+	ix->num_units16 += units16;
+	return true;
+}
+
+// valid text from num_bytes to end (where a sequence ends), the stretches between entries are
+// counted by the vectorized length functions
+static inline bool index_valid(UTF_Index *ix, const uint8_t *s, size_t end) {
+	size_t pos = static_cast<size_t>(ix->num_bytes);
+	bool room = true;
+	while(pos < end) {
+		uint64_t due = static_cast<uint64_t>(ix->num_entries) * ix->step - ix->num_codepoints;
+		if(due >= 32) {
+			// no more than due codepoints start in due bytes, one cut off at the end of them is
+			// counted by its lead and the rest of it skipped
+			size_t n = end - pos < due ? end - pos : static_cast<size_t>(due);
+			ix->num_codepoints += kernels()->utf8_count_codepoints(s + pos, n);
+			ix->num_units16 += kernels()->utf16_length_from_utf8(s + pos, n);
+			for(pos += n; pos < end && (s[pos] & 0xC0) == 0x80; pos++);
+			continue;
+		}
+		uint8_t lead = s[pos];
+		size_t n = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+		if(!(room = index_add(ix, pos, n == 4 ? 2 : 1))) break;
+		pos += n;
+	}
+	ix->num_bytes = pos;
+	return room;
+}
+
+} // namespace utf_detail
+
+UTF_API UTF_Index utf_index(UTF_IndexEntry *entries, size_t cap, uint32_t step) {
+	UTF_Index ix;
+	ix.entries = entries;
+	ix.cap = cap;
+	if(step) ix.step = step;
+	return ix;
+}
+
+UTF_API size_t utf_index_capacity(size_t len, uint32_t step) {
+	return len / (step ? step : 256) + 1;
+}
+
+UTF_API UTF_RESULT utf_index_update(UTF_Index *ix, const void *text, size_t len) {
+	using namespace utf_detail;
+	const uint8_t *s = static_cast<const uint8_t *>(text);
+
+	// validated a block at a time so it's still in cache when it's counted
+	while(ix->num_bytes < len) {
+		size_t pos = static_cast<size_t>(ix->num_bytes), n = len - pos < 65536 ? len - pos : 65536;
+		UTF_Bulk v = utf8_validate(s + pos, n);
+		if(!index_valid(ix, s, pos + v.num_read)) return UTF_OUTPUT_FULL;
+		if(v.result == UTF_OK) continue;
+
+		// an ill-formed subpart, or a sequence cut by the end of the block
+		pos = static_cast<size_t>(ix->num_bytes);
+		UTF_Cp c = utf::decoder<UTF8>::next(s + pos, len - pos);
+		if(c.result == UTF_TOO_FEW_WORDS && pos + c.num_bytes == len) break;
+		if(!index_add(ix, pos, c.codepoint >= 0x10000 ? 2 : 1)) return UTF_OUTPUT_FULL;
+		ix->num_bytes = pos + c.num_bytes;
+	}
+	return UTF_OK;
+}
+
+UTF_API UTF_Offset utf_index_find(const UTF_Index *ix, const void *text, UTF_UNIT unit, uint64_t at) {
+	const uint8_t *s = static_cast<const uint8_t *>(text);
+	UTF_Offset ret;
+	ret.codepoint = ix->num_codepoints;
+	ret.byte = ix->num_bytes;
+	ret.unit16 = ix->num_units16;
+	if(at >= (unit == UTF_UNIT_CODEPOINT ? ret.codepoint : unit == UTF_UNIT_BYTE ? ret.byte : ret.unit16)) return ret;
+
+	// the last entry at or before at
+	size_t e = 0;
+	if(unit == UTF_UNIT_CODEPOINT) e = static_cast<size_t>(at / ix->step);
+	else {
+		for(size_t hi = ix->num_entries; hi - e > 1;) {
+			size_t mid = e + (hi - e) / 2;
+			if((unit == UTF_UNIT_BYTE ? ix->entries[mid].byte : ix->entries[mid].unit16) <= at) e = mid;
+			else hi = mid;
+		}
+	}
+	ret.codepoint = static_cast<uint64_t>(e) * ix->step;
+	ret.byte = ix->entries[e].byte;
+	ret.unit16 = ix->entries[e].unit16;
+
+	// and a codepoint at a time from there, fewer than step of them
+	for(;;) {
+		UTF_Cp c = utf::decoder<UTF8>::next(s + ret.byte, static_cast<size_t>(ix->num_bytes - ret.byte));
+		unsigned units16 = c.codepoint >= 0x10000 ? 2 : 1;
+		uint64_t next = unit == UTF_UNIT_CODEPOINT ? ret.codepoint + 1 : unit == UTF_UNIT_BYTE ? ret.byte + c.num_bytes : ret.unit16 + units16;
+		if(next > at) return ret;
+		ret.codepoint++;
+		ret.byte += c.num_bytes;
+		ret.unit16 += units16;
+	}
+}
+
+
+namespace utf_detail {
+
+// ok of n units went through, errors weigh a lot more than their share: text in the right
+// encoding rarely has any at all
+static inline double detect_score(size_t ok, size_t n) {
+	double r = n ? static_cast<double>(ok) / n : 0;
+	r *= r;
+	r *= r;
+	return r * r;
+}
+
+// how much the bytes in the high half of UTF-16 words look like it, from 0 to 1: they are 0 more often
+// than the low ones (Latin), or they take fewer of the 256 values, h of them to l (any one script)
+static inline double detect_high(size_t hi_zeros, size_t lo_zeros, int h, int l, size_t n16) {
+	double zeros = hi_zeros > lo_zeros ? static_cast<double>(hi_zeros - lo_zeros) / n16 : 0;
+	double values = h < l ? 1 - static_cast<double>(h) / l : 0;
+	return zeros > values ? zeros : values;
+}
+
+// valid words of n32, the byte order a constant so the loop has no branches
+template<UTF_BOM B>
+static inline size_t detect_valid32(const uint8_t *s, size_t n32, size_t *zero32) {
+	size_t valid = 0, zero = 0;
+	for(size_t i = 0; i < n32; i++) {
+		char32_t cp = get32(s + i * 4, B);
+		valid += utf_is_valid_cp(cp);
+		zero += !cp;
+	}
+	*zero32 = zero;
+	return valid;
+}
+
+static inline UTF_Detected detect_bom(const uint8_t *s, size_t len) {
+	UTF_Detected ret;
+	ret.confidence = 100;
+	if(len >= 3 && s[0] == 0xEF && s[1] == 0xBB && s[2] == 0xBF) ret.bom_bytes = 3;
+	// before UTF-16LE, which it starts like
+	else if(len >= 4 && s[0] == 0xFF && s[1] == 0xFE && !s[2] && !s[3]) ret.type = UTF32, ret.bom = UTF_LE, ret.bom_bytes = 4;
+	else if(len >= 4 && !s[0] && !s[1] && s[2] == 0xFE && s[3] == 0xFF) ret.type = UTF32, ret.bom = UTF_BE, ret.bom_bytes = 4;
+	else if(len >= 2 && s[0] == 0xFF && s[1] == 0xFE) ret.type = UTF16, ret.bom = UTF_LE, ret.bom_bytes = 2;
+	else if(len >= 2 && s[0] == 0xFE && s[1] == 0xFF) ret.type = UTF16, ret.bom = UTF_BE, ret.bom_bytes = 2;
+	else ret.confidence = 0;
+	return ret;
+}
+
+} // namespace utf_detail
+
+UTF_API UTF_Detected utf_detect(const void *text, size_t len) {
+	using namespace utf_detail;
+	const uint8_t *s = static_cast<const uint8_t *>(text);
+	UTF_Detected ret = detect_bom(s, len);
+	if(ret.bom_bytes) return ret;
+
+	// a sequence cut off by the end of the sample isn't an error, nor is a length that doesn't
+	// divide into words
+	size_t n = len < UTF_DETECT_SAMPLE ? len : UTF_DETECT_SAMPLE, n16 = n / 2, n32 = n / 4;
+	bool cut = n < len;
+	const utf_kernels *k = kernels();
+	size_t z[DETECT_COUNTS] = { 0 };
+	k->detect_counts(s, n, z);
+	double best = 0;
+	auto pick = [&](UTF_TYPE t, UTF_BOM en, double score) {
+		if(score <= best) return;
+		best = score;
+		ret.type = t;
+		ret.bom = en;
+		ret.confidence = static_cast<uint8_t>(score * 100 + 0.5);
+	};
+
+	// the counts above give the most each encoding can score, the rest of the work for it is
+	// skipped when that's no better than what's been found already
+	const UTF_BOM boms[] = { UTF_LE, UTF_BE };
+
+	// UTF-32, no more of the words are valid than have their top byte 0, with half of them it would
+	// score under 0.004
+	for(UTF_BOM en : boms) {
+		if(!n32 || (!cut && n % 4)) break;
+		if(z[en == UTF_LE ? 3 : 0] * 2 < n32) continue;
+		size_t zero32, valid = en == UTF_LE ? detect_valid32<UTF_LE>(s, n32, &zero32) : detect_valid32<UTF_BE>(s, n32, &zero32);
+		pick(UTF32, en, detect_score(valid, n32) * (1 - static_cast<double>(zero32) / n32));
+	}
+	if(best == 1) return ret;
+
+	// UTF-8, zeros and controls aren't text; once over an eighth of what's been looked at is broken
+	// the score is down to a third and the rest isn't looked at
+	double text8 = n ? 1 - static_cast<double>(z[0] + z[1] + z[2] + z[3] + z[DETECT_CONTROLS]) / n : 0;
+	if(text8 > best) {
+		size_t n8 = cut ? utf8_boundary(s, n, n) : n, bad = 0;
+		for(size_t i = 0; i < n8;) {
+			UTF_Bulk b = k->validate(s + i, n8 - i);
+			if(b.result == UTF_OK) break;
+			i += b.num_read;
+			size_t w = utf::decoder<UTF8>::next(s + i, n8 - i).num_bytes;
+			bad += w;
+			i += w;
+			if(i >= 256 && bad * 8 > i) n8 = i;
+		}
+		pick(UTF8, UTF_LE, detect_score(n8 - bad, n8) * text8);
+		if(best == 1) return ret;
+	}
+
+	// UTF-16, zero words aren't text, and the high bytes of words differ from the low ones
+	if(!n16 || (!cut && n % 2) || 1 - static_cast<double>(z[DETECT_ZERO16]) / n16 <= best) return ret;
+	uint8_t seen[2][256];
+	memset(seen, 0, sizeof(seen));
+	for(size_t i = 0; i < n16; i++) seen[0][s[i * 2]] = seen[1][s[i * 2 + 1]] = 1;
+	int even = 0, odd = 0;
+	for(int v = 0; v < 256; v++) {
+		even += seen[0][v];
+		odd += seen[1][v];
+	}
+	for(UTF_BOM en : boms) {
+		// a high surrogate at the end is only cut off by the sample
+		size_t bad16 = z[en == UTF_LE ? DETECT_UNPAIRED16_LE : DETECT_UNPAIRED16_BE] + (!cut && (s[n16 * 2 - (en == UTF_LE ? 1 : 2)] & 0xFC) == 0xD8);
+		double high = en == UTF_LE ? detect_high(z[1] + z[3], z[0] + z[2], odd, even, n16) : detect_high(z[0] + z[2], z[1] + z[3], even, odd, n16);
+		pick(UTF16, en, detect_score(n16 - bad16, n16) * high * (1 - static_cast<double>(z[DETECT_ZERO16]) / n16));
+	}
+	return ret;
+}
+
+
+// files
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#ifndef UTF_NO_THREADS
+#include <future>
+#endif
+
+namespace utf_detail {
+
+static inline int write_all(int fd, const uint8_t *p, size_t n) {
+	while(n) {
+		ssize_t w = write(fd, p, n);
+		if(w < 0 && errno == EINTR) continue;
+		if(w < 0) return errno;
+		p += w;
+		n -= static_cast<size_t>(w);
+	}
+	return 0;
+}
+
+// two output buffers, one is filled while the other is being written
+struct batch_writer {
+	int fd, cur = 0, error = 0;
+	std::vector<uint8_t> buf[2];
+#ifndef UTF_NO_THREADS
+	std::future<int> pending;
+#endif
+
+	explicit batch_writer(int fd) : fd(fd) {
+		buf[0].resize(UTF_FILE_BATCH);
+		buf[1].resize(UTF_FILE_BATCH);
+	}
+
+	uint8_t *data() { return buf[cur].data(); }
+
+	// n bytes of data() go out and data() moves to the other buffer, false once a write failed
+	bool flush(size_t n) {
+		if(wait() || !n) return !error;
+#ifndef UTF_NO_THREADS
+		pending = std::async(std::launch::async, write_all, fd, buf[cur].data(), n);
+#else
+		error = write_all(fd, buf[cur].data(), n);
+#endif
+		cur ^= 1;
+		return !error;
+	}
+
+	int wait() {
+#ifndef UTF_NO_THREADS
+		if(pending.valid()) {
+			int e = pending.get();
+			if(!error) error = e;
+		}
+#endif
+		return error;
+	}
+};
+
+// text in memory out through w
+static UTF_FileBulk transcode_batches(const uint8_t *s, size_t len, UTF_TYPE from, UTF_BOM from_bom, batch_writer &w, UTF_TYPE to, UTF_BOM to_bom) {
+	UTF_FileBulk ret;
+	const size_t ws_from = word_size(from), ws_to = word_size(to);
+	for(;;) {
+		UTF_Bulk b = utf_transcode(s + ret.num_read * ws_from, len - ret.num_read, from, from_bom, w.data(), UTF_FILE_BATCH / ws_to, to, to_bom);
+		ret.num_read += b.num_read;
+		ret.num_written += b.num_written;
+		if(!w.flush(b.num_written * ws_to)) break;
+		if(b.result != UTF_OUTPUT_FULL) {
+			ret.result = b.result;
+			break;
+		}
+	}
+	ret.error = w.wait();
+	return ret;
+}
+
+// input that can't be mapped, read() a batch at a time
+static UTF_FileBulk transcode_reads(int in, UTF_TYPE from, UTF_BOM from_bom, batch_writer &w, UTF_TYPE to, UTF_BOM to_bom) {
+	UTF_FileBulk ret;
+	UTF_Stream st = utf_stream(from, from_bom, to, to_bom);
+	const size_t ws_to = word_size(to), cap = UTF_FILE_BATCH / ws_to;
+	std::vector<uint8_t> chunk(UTF_FILE_BATCH);
+	uint64_t bytes = 0;
+	size_t o = 0;
+
+	while(ret.result == UTF_OK && !w.error) {
+		ssize_t n = read(in, chunk.data(), chunk.size());
+		if(n < 0 && errno == EINTR) continue;
+		if(n < 0) {
+			ret.error = errno;
+			break;
+		}
+		if(!n) {
+			ret.result = utf_stream_end(&st);
+			break;
+		}
+
+		for(size_t k = 0;;) {
+			UTF_Bulk b = utf_stream_write(&st, chunk.data() + k, static_cast<size_t>(n) - k, w.data() + o * ws_to, cap - o);
+			k += b.num_read;
+			o += b.num_written;
+			ret.num_written += b.num_written;
+			if(b.result != UTF_OUTPUT_FULL) ret.result = b.result;
+			if(b.result != UTF_OUTPUT_FULL || !w.flush(o * ws_to)) {
+				bytes += k;
+				break;
+			}
+			o = 0;
+		}
+	}
+
+	// a sequence still pending hasn't been read as far as the caller is concerned
+	ret.num_read = (bytes - st.num_pending) / word_size(from);
+	w.flush(o * ws_to);
+	if(!ret.error) ret.error = w.wait();
+	return ret;
+}
+
+} // namespace utf_detail
+
+UTF_API UTF_FileBulk utf_transcode_fd(int in, UTF_TYPE from, UTF_BOM from_bom, int out, UTF_TYPE to, UTF_BOM to_bom) {
+	using namespace utf_detail;
+	const size_t ws_from = word_size(from), ws_to = word_size(to);
+	static uint8_t empty[4];
+	UTF_FileBulk ret;
+	struct stat si, so;
+	if(fstat(in, &si) || fstat(out, &so)) {
+		ret.error = errno;
+		return ret;
+	}
+
+	// the input from where in is to the end, a word cut off at the end is UTF_TOO_FEW_WORDS after the rest
+	off_t at = S_ISREG(si.st_mode) ? lseek(in, 0, SEEK_CUR) : -1;
+	uint8_t *map = static_cast<uint8_t *>(MAP_FAILED);
+	size_t map_bytes = at >= 0 && si.st_size > at ? static_cast<size_t>(si.st_size) : 0;
+	if(map_bytes) {
+		map = static_cast<uint8_t *>(mmap(nullptr, map_bytes, PROT_READ, MAP_PRIVATE, in, 0));
+		if(map != MAP_FAILED) madvise(map, map_bytes, MADV_SEQUENTIAL);
+	}
+	bool mapped = map != MAP_FAILED || (at >= 0 && !map_bytes);
+	const uint8_t *s = map != MAP_FAILED ? map + at : empty;
+	size_t len = map != MAP_FAILED ? (map_bytes - static_cast<size_t>(at)) / ws_from : 0;
+	bool cut = map != MAP_FAILED && (map_bytes - static_cast<size_t>(at)) % ws_from;
+
+	// the output mapped at its exact size, a file system that can't do that gets the writes
+	uint8_t *d = static_cast<uint8_t *>(MAP_FAILED);
+	size_t cap = 0, bytes = 0;
+	int flags = fcntl(out, F_GETFL);
+	if(mapped && S_ISREG(so.st_mode) && flags != -1 && (flags & (O_ACCMODE | O_APPEND)) == O_RDWR && lseek(out, 0, SEEK_CUR) == 0) {
+		cap = transcoded_length(s, len, from, from_bom, to);
+		bytes = cap * ws_to;
+		if(!bytes) d = empty;
+		else if(!ftruncate(out, static_cast<off_t>(bytes))) {
+			d = static_cast<uint8_t *>(mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, out, 0));
+			if(d != MAP_FAILED) madvise(d, bytes, MADV_SEQUENTIAL);
+			else if(ftruncate(out, 0)) ret.error = errno;
+		}
+	}
+
+	if(d != MAP_FAILED) {
+		UTF_Bulk b = utf_transcode_parallel(s, len, from, from_bom, d, cap, to, to_bom, 0);
+		if(bytes) munmap(d, bytes);
+		ret.result = b.result;
+		ret.num_read = b.num_read;
+		ret.num_written = b.num_written;
+		off_t end = static_cast<off_t>(b.num_written * ws_to);
+		if(ftruncate(out, end) || lseek(out, end, SEEK_SET) < 0) ret.error = errno;
+	}
+	else if(!ret.error) {
+		batch_writer w(out);
+		ret = mapped ? transcode_batches(s, len, from, from_bom, w, to, to_bom) : transcode_reads(in, from, from_bom, w, to, to_bom);
+	}
+
+	if(map != MAP_FAILED) munmap(map, map_bytes);
+	if(ret.result == UTF_OK && !ret.error && cut) ret.result = UTF_TOO_FEW_WORDS;
+	return ret;
+}
+
+UTF_API UTF_FileBulk utf_transcode_file(const char *src_path, UTF_TYPE from, UTF_BOM from_bom, const char *dst_path, UTF_TYPE to, UTF_BOM to_bom) {
+	UTF_FileBulk ret;
+	int in = open(src_path, O_RDONLY | O_CLOEXEC);
+	if(in < 0) {
+		ret.error = errno;
+		return ret;
+	}
+	int out = open(dst_path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+	if(out < 0) ret.error = errno;
+	else {
+		ret = utf_transcode_fd(in, from, from_bom, out, to, to_bom);
+		if(close(out) && !ret.error) ret.error = errno;
+	}
+	close(in);
+	return ret;
+}
+#endif // __linux__
+
+// unicode properties
+
+namespace utf_detail {
+
+// generated by gen_tables.cpp from ucd_props.txt, don't edit
+// Unicode 14.0.0, 25152 bytes
+
+static const uint8_t prop_top[1088] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 17, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 18, 19, 19, 20, 20, 20, 20, 20, 20, 21, 22,
+	23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 33, 33, 33, 37, 33, 33, 33, 33, 33, 33, 33, 33, 38, 39, 13, 13, 13, 13,
+	13, 40, 13, 41, 33, 33, 33, 33, 33, 33, 33, 42, 43, 33, 33, 44, 33, 33, 33, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 33,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 57, 13, 13, 13, 58, 59, 13, 13, 13, 13, 60, 13, 13, 13, 13, 13, 13, 61, 62, 62, 62, 63, 64,
+	13, 13, 13, 13, 65, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 64,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	66, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 67,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 67,
+};
+
+static const uint16_t prop_mid[68][32] = {
+	{
+		0, 1, 2, 3, 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+		7, 15, 16, 17, 18, 19, 20, 21, 22, 22, 22, 23, 24, 25, 26, 27,
+	},
+	{
+		28, 29, 17, 7, 30, 7, 31, 7, 7, 32, 33, 17, 34, 35, 36, 37,
+		38, 39, 40, 41, 39, 39, 42, 43, 44, 45, 46, 39, 39, 47, 48, 49,
+	},
+	{
+		50, 51, 52, 53, 54, 39, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+		65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	},
+	{
+		81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+		97, 98, 99, 100, 101, 102, 103, 100, 104, 105, 106, 107, 108, 109, 110, 100,
+	},
+	{
+		39, 111, 112, 113, 114, 28, 115, 116, 117, 117, 117, 118, 118, 118, 118, 118,
+		39, 39, 119, 39, 120, 121, 122, 39, 123, 39, 124, 125, 126, 28, 28, 127,
+	},
+	{
+		128, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+		39, 39, 39, 129, 130, 39, 39, 131, 132, 133, 134, 135, 39, 136, 137, 138,
+	},
+	{
+		139, 39, 140, 141, 142, 143, 39, 144, 145, 146, 147, 148, 39, 149, 150, 151,
+		152, 39, 153, 154, 155, 156, 157, 100, 158, 159, 160, 161, 162, 163, 39, 164,
+	},
+	{
+		39, 165, 166, 167, 168, 169, 170, 171, 17, 172, 173, 174, 175, 173, 22, 22,
+		7, 7, 7, 7, 176, 7, 7, 7, 177, 178, 179, 180, 181, 182, 183, 184,
+	},
+	{
+		185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200,
+		201, 201, 201, 201, 201, 201, 201, 201, 202, 203, 151, 204, 205, 206, 207, 208,
+	},
+	{
+		151, 209, 210, 211, 212, 151, 151, 213, 151, 151, 151, 151, 151, 214, 215, 216,
+		217, 151, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+	},
+	{
+		151, 151, 151, 151, 151, 151, 151, 151, 201, 201, 201, 201, 232, 201, 233, 234,
+		201, 201, 201, 201, 201, 201, 201, 201, 235, 236, 237, 238, 239, 151, 151, 151,
+	},
+	{
+		28, 29, 17, 240, 7, 7, 7, 241, 17, 242, 39, 243, 244, 245, 245, 22,
+		246, 247, 248, 100, 249, 250, 250, 251, 250, 250, 250, 250, 250, 250, 252, 253,
+	},
+	{
+		254, 255, 256, 117, 257, 258, 117, 259, 260, 261, 117, 117, 262, 117, 250, 263,
+		264, 265, 266, 250, 265, 267, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 151, 151,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+	},
+	{
+		268, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+	},
+	{
+		117, 117, 117, 117, 269, 250, 270, 167, 39, 39, 39, 39, 39, 39, 39, 39,
+		271, 272, 7, 273, 274, 39, 39, 275, 276, 277, 7, 278, 279, 280, 281, 282,
+	},
+	{
+		283, 284, 39, 285, 286, 287, 288, 289, 48, 290, 291, 292, 57, 293, 294, 295,
+		39, 296, 297, 298, 39, 299, 300, 301, 302, 303, 304, 305, 17, 17, 39, 306,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 307, 308, 309,
+	},
+	{
+		310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+		310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+	},
+	{
+		311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311,
+		311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311,
+	},
+	{
+		311, 311, 311, 311, 311, 311, 311, 311, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 312, 117, 117, 313, 314, 315, 316, 317, 39, 39, 318, 319, 39,
+	},
+	{
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 320, 321, 39, 322, 39, 323, 324,
+		325, 326, 327, 328, 39, 39, 39, 329, 330, 331, 332, 333, 334, 145, 335, 336,
+	},
+	{
+		337, 338, 339, 100, 39, 39, 39, 340, 341, 342, 196, 343, 344, 345, 346, 347,
+		100, 100, 100, 100, 348, 39, 349, 350, 39, 351, 352, 353, 354, 39, 355, 100,
+	},
+	{
+		28, 356, 357, 39, 358, 359, 360, 361, 39, 362, 39, 363, 364, 365, 100, 100,
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 244, 144, 366, 367, 368, 100, 100,
+	},
+	{
+		369, 370, 371, 372, 145, 373, 100, 374, 375, 376, 100, 100, 39, 377, 378, 211,
+		379, 380, 381, 382, 383, 100, 384, 385, 39, 386, 387, 388, 389, 390, 100, 100,
+	},
+	{
+		39, 39, 391, 100, 28, 392, 17, 393, 39, 394, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 395, 39, 396, 100, 100, 383, 397, 398, 399, 400, 399, 401, 244,
+	},
+	{
+		402, 403, 404, 405, 162, 406, 407, 408, 409, 410, 411, 412, 162, 413, 414, 415,
+		416, 417, 100, 100, 418, 419, 420, 421, 422, 423, 424, 425, 100, 100, 100, 100,
+	},
+	{
+		39, 426, 427, 428, 39, 429, 430, 100, 100, 100, 100, 100, 39, 431, 432, 100,
+		39, 433, 434, 435, 39, 436, 437, 100, 124, 438, 439, 100, 100, 100, 100, 100,
+	},
+	{
+		39, 440, 100, 100, 100, 28, 17, 441, 442, 443, 444, 100, 100, 445, 446, 447,
+		448, 449, 450, 39, 451, 452, 39, 141, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		453, 454, 455, 456, 457, 458, 100, 100, 459, 460, 461, 462, 463, 437, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 464, 100, 100, 100, 100, 100, 465, 466, 467,
+	},
+	{
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 468, 100, 100, 100,
+	},
+	{
+		196, 196, 196, 469, 39, 39, 39, 39, 39, 39, 470, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 399, 39, 39, 471,
+	},
+	{
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+	},
+	{
+		39, 472, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+		39, 39, 439, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+		39, 141, 145, 473, 39, 145, 474, 475, 39, 476, 477, 478, 479, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 28, 17, 480, 100, 100, 100, 39, 39, 481, 482, 483, 100, 100, 484,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 485,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 486, 100, 487, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 488,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 489, 490, 491, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 492, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		39, 39, 39, 493, 494, 495, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 22, 496, 497, 151, 151, 151, 498, 100,
+	},
+	{
+		151, 151, 151, 151, 151, 151, 151, 499, 151, 500, 151, 501, 502, 503, 151, 210,
+		151, 151, 504, 100, 100, 100, 100, 505, 151, 151, 506, 507, 100, 100, 100, 100,
+	},
+	{
+		508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 508, 509, 521,
+		511, 522, 523, 524, 515, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+	},
+	{
+		151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+		22, 536, 22, 537, 538, 539, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 540, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		541, 542, 100, 100, 100, 100, 100, 100, 39, 543, 544, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 399, 545, 39, 546, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 547,
+	},
+	{
+		39, 39, 39, 39, 39, 39, 548, 100, 28, 549, 550, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		100, 100, 100, 551, 211, 552, 100, 100, 553, 554, 100, 100, 100, 100, 100, 100,
+		555, 556, 557, 558, 559, 560, 100, 561, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		562, 563, 151, 151, 564, 565, 566, 499, 567, 151, 151, 151, 568, 569, 100, 570,
+		571, 572, 573, 574, 100, 100, 100, 100, 250, 575, 250, 576, 577, 250, 578, 579,
+	},
+	{
+		250, 580, 581, 250, 250, 250, 250, 582, 250, 583, 584, 585, 586, 562, 151, 587,
+		250, 250, 588, 151, 250, 250, 589, 590, 151, 151, 151, 564, 151, 151, 591, 592,
+	},
+	{
+		563, 151, 593, 151, 594, 595, 100, 100, 596, 597, 598, 250, 250, 250, 250, 250,
+		151, 151, 564, 599, 600, 601, 602, 603, 151, 151, 151, 151, 604, 151, 210, 605,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 314, 117, 117, 117, 117, 117, 117, 117, 117,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 606, 117, 117, 117, 117, 117, 117,
+	},
+	{
+		607, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 608, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 609,
+	},
+	{
+		314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+		314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		607, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+	},
+	{
+		314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+		314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 610,
+	},
+	{
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 611, 314, 314, 314, 314, 314,
+	},
+	{
+		612, 613, 613, 613, 100, 100, 100, 100, 22, 22, 22, 22, 22, 22, 22, 614,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311,
+		311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 615,
+	},
+};
+
+static const uint8_t prop_leaf[616][32] = {
+	{ 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26 },
+	{ 55, 50, 50, 50, 52, 50, 50, 50, 46, 47, 50, 51, 50, 45, 50, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 50, 51, 51, 51, 50 },
+	{ 50, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 46, 50, 47, 53, 44 },
+	{ 53, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 46, 51, 47, 51, 26 },
+	{ 55, 50, 52, 52, 52, 52, 54, 50, 53, 54, 37, 48, 51, 59, 54, 53, 54, 51, 43, 43, 53, 34, 50, 50, 53, 43, 37, 49, 43, 43, 43, 50 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 51, 33, 33, 33, 33, 33, 33, 33, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 51, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 34, 33, 34, 33, 34, 33 },
+	{ 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 33, 34, 33, 34, 33, 34, 34 },
+	{ 34, 33, 33, 34, 33, 34, 33, 33, 34, 33, 33, 33, 34, 34, 33, 33, 33, 33, 34, 33, 33, 34, 33, 33, 33, 34, 34, 34, 33, 33, 34, 33 },
+	{ 33, 34, 33, 34, 33, 34, 33, 33, 34, 33, 34, 34, 33, 34, 33, 33, 34, 33, 33, 33, 34, 33, 34, 33, 33, 34, 34, 37, 33, 34, 34, 34 },
+	{ 37, 37, 37, 37, 33, 35, 34, 33, 35, 34, 33, 35, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 35, 34, 33, 34, 33, 33, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 34, 34, 34, 34, 34, 33, 33, 34, 33, 33, 34 },
+	{ 34, 33, 34, 33, 33, 33, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 37, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36 },
+	{ 36, 36, 53, 53, 53, 53, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53 },
+	{ 36, 36, 36, 36, 36, 53, 53, 53, 53, 53, 53, 53, 36, 53, 36, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 33, 34, 33, 34, 36, 53, 33, 34, 32, 32, 36, 34, 34, 34, 50, 33 },
+	{ 32, 32, 32, 32, 53, 53, 33, 50, 33, 33, 33, 32, 33, 32, 33, 33, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 34, 34, 33, 33, 33, 34, 34, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 34, 34, 34, 33, 34, 51, 33, 34, 33, 33, 34, 34, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 33, 34, 54, 6, 6, 6, 6, 6, 8, 8, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 36, 50, 50, 50, 50, 50, 50 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 45, 32, 32, 54, 54, 52, 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 45, 6 },
+	{ 50, 6, 6, 50, 6, 6, 50, 6, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 37, 37, 37, 37, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 27, 27, 27, 27, 27, 27, 51, 51, 51, 50, 50, 52, 50, 50, 54, 54, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 50, 27, 50, 50, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 50, 50, 50, 37, 37, 6, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 50, 37, 6, 6, 6, 6, 6, 6, 6, 27, 54, 6 },
+	{ 6, 6, 6, 6, 6, 36, 36, 6, 6, 54, 6, 6, 6, 6, 37, 37, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 37, 54, 54, 37 },
+	{ 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32, 27, 37, 6, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 36, 36, 54, 50, 50, 50, 36, 32, 32, 6, 52, 52 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 36, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 36, 6, 6, 6, 36, 6, 6, 6, 6, 6, 32, 32, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 32, 32, 50, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 53, 37, 37, 37, 37, 37, 37, 32, 27, 27, 32, 32, 32, 32, 32, 32, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 27, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 39, 6, 37, 39, 39 },
+	{ 39, 6, 6, 6, 6, 6, 6, 6, 6, 39, 39, 39, 39, 6, 39, 39, 37, 6, 6, 6, 6, 6, 6, 6, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 6, 6, 50, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 6, 39, 39, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 32, 32, 32, 37, 37, 37, 37, 32, 32, 6, 37, 39, 39 },
+	{ 39, 6, 6, 6, 6, 32, 32, 39, 39, 32, 32, 39, 39, 6, 37, 32, 32, 32, 32, 32, 32, 32, 32, 39, 32, 32, 32, 32, 37, 37, 32, 37 },
+	{ 37, 37, 6, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 52, 52, 43, 43, 43, 43, 43, 43, 54, 52, 37, 50, 6, 32 },
+	{ 32, 6, 6, 39, 32, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 32, 32, 6, 32, 39, 39 },
+	{ 39, 6, 6, 32, 32, 32, 32, 6, 6, 32, 32, 6, 6, 6, 32, 32, 32, 6, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 32, 37, 32 },
+	{ 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 6, 6, 37, 37, 37, 6, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 6, 6, 39, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 32, 32, 6, 37, 39, 39 },
+	{ 39, 6, 6, 6, 6, 6, 32, 6, 6, 39, 32, 39, 39, 6, 32, 32, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 6, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 52, 32, 32, 32, 32, 32, 32, 32, 37, 6, 6, 6, 6, 6, 6 },
+	{ 32, 6, 39, 39, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 32, 32, 6, 37, 39, 6 },
+	{ 39, 6, 6, 6, 6, 32, 32, 39, 39, 32, 32, 39, 39, 6, 32, 32, 32, 32, 32, 32, 32, 6, 6, 39, 32, 32, 32, 32, 37, 37, 32, 37 },
+	{ 37, 37, 6, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 54, 37, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 6, 37, 32, 37, 37, 37, 37, 37, 37, 32, 32, 32, 37, 37, 37, 32, 37, 37, 37, 37, 32, 32, 32, 37, 37, 32, 37, 32, 37, 37 },
+	{ 32, 32, 32, 37, 37, 32, 32, 32, 37, 37, 37, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 39, 39 },
+	{ 6, 39, 39, 32, 32, 32, 39, 39, 39, 32, 39, 39, 39, 6, 32, 32, 37, 32, 32, 32, 32, 32, 32, 39, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 43, 54, 54, 54, 54, 54, 54, 52, 54, 32, 32, 32, 32, 32 },
+	{ 6, 39, 39, 39, 6, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 6, 37, 6, 6 },
+	{ 6, 39, 39, 39, 39, 32, 6, 6, 6, 32, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 6, 6, 32, 37, 37, 37, 32, 32, 37, 32, 32 },
+	{ 37, 37, 6, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32, 32, 50, 43, 43, 43, 43, 43, 43, 43, 54 },
+	{ 37, 6, 39, 39, 50, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 32, 32, 6, 37, 39, 6 },
+	{ 39, 39, 39, 39, 39, 32, 6, 39, 39, 32, 39, 39, 6, 6, 32, 32, 32, 32, 32, 32, 32, 39, 39, 32, 32, 32, 32, 32, 32, 37, 37, 32 },
+	{ 37, 37, 6, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 6, 6, 39, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 37, 39, 39 },
+	{ 39, 6, 6, 6, 6, 32, 39, 39, 39, 32, 39, 39, 39, 6, 37, 54, 32, 32, 32, 32, 37, 37, 37, 39, 43, 43, 43, 43, 43, 43, 43, 37 },
+	{ 37, 37, 6, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 37, 37, 37, 37, 37, 37 },
+	{ 32, 6, 39, 39, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 6, 32, 32, 32, 32, 39, 39, 39, 6, 6, 6, 32, 6, 32, 39, 39, 39, 39, 39, 39, 39, 39 },
+	{ 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 39, 39, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 37, 37, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 52 },
+	{ 37, 37, 37, 37, 37, 37, 36, 6, 6, 6, 6, 6, 6, 6, 6, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 50, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 37, 37, 32, 37, 32, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 32, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 37, 32, 32 },
+	{ 37, 37, 37, 37, 37, 32, 36, 32, 6, 6, 6, 6, 6, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 37, 37, 37, 37 },
+	{ 37, 54, 54, 54, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 54, 50, 54, 54, 54, 6, 6, 54, 54, 54, 54, 54, 54 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 6, 54, 6, 54, 6, 46, 47, 46, 47, 39, 39 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 39 },
+	{ 6, 6, 6, 6, 6, 50, 6, 6, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 6, 54, 54, 54, 54, 54, 54, 32, 54, 54, 50, 50, 50, 50, 50, 54, 54, 54, 54, 50, 50, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 6, 6, 6, 6, 39, 6, 6, 6, 6, 6, 6, 39, 6, 6, 39, 39, 6, 6, 37 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 50, 50, 50, 50, 50, 37, 37, 37, 37, 37, 37, 39, 39, 6, 6, 37, 37, 37, 37, 6, 6 },
+	{ 6, 37, 39, 39, 39, 37, 37, 39, 39, 39, 39, 39, 39, 39, 37, 37, 37, 6, 6, 6, 6, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 6, 39, 39, 6, 6, 39, 39, 39, 39, 39, 39, 6, 37, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 39, 39, 6, 54, 54 },
+	{ 33, 33, 33, 33, 33, 33, 32, 33, 32, 32, 32, 32, 32, 33, 32, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 36, 34, 34, 34 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 32, 37, 37, 37, 37, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 32 },
+	{ 37, 32, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 6, 6, 6 },
+	{ 50, 50, 50, 50, 50, 50, 50, 50, 50, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 34, 34, 34, 34, 34, 34, 32, 32 },
+	{ 45, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 54, 50, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 55, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 46, 47, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 50, 50, 50, 42, 42, 42, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 39, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 39, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 32, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 39, 6, 6, 6, 6, 6, 6, 6, 39, 39 },
+	{ 39, 39, 39, 39, 39, 39, 6, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 50, 50, 50, 36, 50, 50, 50, 52, 37, 6, 32, 32 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32 },
+	{ 50, 50, 50, 50, 50, 50, 45, 50, 50, 50, 50, 6, 6, 6, 27, 6, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 6, 6, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 37, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32 },
+	{ 6, 6, 6, 39, 39, 39, 39, 6, 6, 39, 39, 39, 32, 32, 32, 32, 39, 39, 6, 39, 39, 39, 39, 39, 39, 6, 6, 6, 32, 32, 32, 32 },
+	{ 54, 32, 32, 32, 50, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 32, 32, 32, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 39, 39, 6, 32, 32, 50, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 6, 39, 6, 6, 6, 6, 6, 6, 6, 32 },
+	{ 6, 39, 6, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 39, 39, 39, 39, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 6 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 50, 50, 50, 50, 50, 50, 50, 36, 50, 50, 50, 50, 50, 50, 32, 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 6, 6, 6, 6, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 39, 6, 6, 6, 6, 6, 39, 6, 39, 39, 39 },
+	{ 39, 39, 6, 39, 39, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 50, 50, 50, 50, 50 },
+	{ 50, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 6, 6, 6, 6, 6, 6, 6, 6, 6, 54, 54, 54, 54, 54, 54, 54, 54, 54, 50, 50, 32 },
+	{ 6, 6, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 39, 6, 6, 6, 6, 39, 39, 6, 6, 39, 6, 6, 6, 37, 37, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 6, 39, 6, 6, 39, 39, 39, 6, 39, 6, 6, 6, 39, 39, 32, 32, 32, 32, 32, 32, 32, 32, 50, 50, 50, 50 },
+	{ 37, 37, 37, 37, 39, 39, 39, 39, 39, 39, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 39, 39, 6, 6, 32, 32, 32, 50, 50, 50, 50, 50 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 37, 37, 37, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 36, 36, 36, 36, 36, 50, 50 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 33, 33, 33 },
+	{ 50, 50, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 6, 6, 6, 50, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 39, 6, 6, 6, 6, 6, 6, 6, 37, 37, 37, 37, 6, 37, 37, 37, 37, 37, 37, 6, 37, 37, 39, 6, 6, 37, 32, 32, 32, 32, 32 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36 },
+	{ 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36 },
+	{ 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 36, 36, 36, 36 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 32, 32, 33, 33, 33, 33, 33, 33, 32, 32 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 34, 34, 34, 34, 34, 34, 32, 32, 33, 33, 33, 33, 33, 33, 32, 32, 34, 34, 34, 34, 34, 34, 34, 34, 32, 33, 32, 33, 32, 33, 32, 33 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 32 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 34, 34, 34, 34, 34, 32, 34, 34, 33, 33, 33, 33, 35, 53, 34, 53 },
+	{ 53, 53, 34, 34, 34, 32, 34, 34, 33, 33, 33, 33, 35, 53, 53, 53, 34, 34, 34, 34, 32, 32, 34, 34, 33, 33, 33, 33, 32, 53, 53, 53 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 53, 53, 53, 32, 32, 34, 34, 34, 32, 34, 34, 33, 33, 33, 33, 35, 53, 53, 32 },
+	{ 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 27, 27, 27, 27, 27, 45, 45, 45, 45, 45, 45, 50, 50, 48, 49, 46, 48, 48, 49, 46, 48 },
+	{ 50, 50, 50, 50, 50, 50, 50, 50, 24, 25, 27, 27, 27, 27, 27, 55, 50, 50, 50, 50, 50, 50, 50, 50, 50, 48, 49, 50, 50, 50, 50, 44 },
+	{ 44, 50, 50, 50, 51, 46, 47, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 51, 50, 44, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 55 },
+	{ 27, 27, 27, 27, 27, 32, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 43, 36, 32, 32, 43, 43, 43, 43, 43, 43, 51, 51, 51, 46, 47, 36 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 51, 51, 51, 46, 47, 32, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 32, 32, 32 },
+	{ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52 },
+	{ 52, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8 },
+	{ 8, 6, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 33, 54, 54, 54, 54, 33, 54, 54, 34, 33, 33, 33, 34, 34, 33, 33, 33, 34, 54, 33, 54, 54, 51, 33, 33, 33, 33, 33, 54, 54 },
+	{ 54, 54, 54, 54, 33, 54, 33, 54, 33, 54, 33, 33, 33, 33, 54, 34, 33, 33, 33, 33, 34, 37, 37, 37, 37, 34, 54, 54, 34, 34, 33, 33 },
+	{ 51, 51, 51, 51, 51, 33, 34, 34, 34, 34, 54, 51, 54, 54, 34, 54, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42 },
+	{ 42, 42, 42, 33, 34, 42, 42, 42, 42, 43, 54, 54, 32, 32, 32, 32, 51, 51, 51, 51, 51, 54, 54, 54, 54, 54, 51, 51, 54, 54, 54, 54 },
+	{ 51, 54, 54, 51, 54, 54, 51, 54, 54, 54, 54, 54, 54, 54, 51, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 51, 54, 54, 51, 54, 51, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51 },
+	{ 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 46, 47, 46, 47, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 54, 54, 54, 54 },
+	{ 51, 51, 54, 54, 54, 54, 54, 54, 54, 78, 79, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 51, 51, 51, 51 },
+	{ 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 51, 51, 51 },
+	{ 51, 51, 54, 54, 54, 54, 54, 54, 54, 86, 86, 86, 86, 54, 54, 54, 86, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 51, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 51, 51, 51, 51, 83, 83, 51 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 54 },
+	{ 54, 54, 54, 54, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 86, 86, 54, 86, 54, 54, 54, 54, 86, 54, 54, 86, 54, 54 },
+	{ 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 86, 54, 54, 54, 54, 86, 86, 86, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 86, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86 },
+	{ 51, 51, 51, 51, 51, 46, 47, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51 },
+	{ 51, 51, 51, 51, 51, 51, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51 },
+	{ 51, 51, 51, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 46, 47, 51, 51, 51, 51, 51, 51, 51 },
+	{ 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 46, 47, 46, 47, 51, 51, 51, 51 },
+	{ 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 46, 47, 51, 51 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51 },
+	{ 51, 51, 51, 51, 51, 54, 54, 51, 51, 51, 51, 51, 51, 54, 54, 54, 86, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 33, 34, 33, 33, 33, 34, 34, 33, 34, 33, 34, 33, 34, 33, 33, 33, 33, 34, 33, 34, 34, 33, 34, 34, 34, 34, 34, 34, 36, 36, 33, 33 },
+	{ 33, 34, 33, 34, 34, 54, 54, 54, 54, 54, 54, 33, 34, 33, 34, 6, 6, 6, 33, 34, 32, 32, 32, 32, 32, 50, 50, 50, 50, 43, 50, 50 },
+	{ 34, 34, 34, 34, 34, 34, 32, 34, 32, 32, 32, 32, 32, 34, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 36, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 6 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32 },
+	{ 50, 50, 48, 49, 48, 49, 50, 50, 50, 48, 49, 50, 48, 49, 50, 50, 50, 50, 50, 50, 50, 50, 50, 45, 50, 50, 45, 50, 48, 49, 50, 50 },
+	{ 48, 49, 46, 47, 46, 47, 46, 47, 46, 47, 50, 50, 50, 50, 50, 36, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 45, 45, 50, 50, 50, 50 },
+	{ 45, 50, 46, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 54, 54, 50, 50, 50, 46, 47, 46, 47, 46, 47, 46, 47, 45, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32 },
+	{ 87, 82, 82, 82, 86, 68, 69, 74, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 86, 86, 78, 79, 78, 79, 78, 79, 78, 79, 77, 78, 79, 79 },
+	{ 86, 74, 74, 74, 74, 74, 74, 74, 74, 74, 6, 6, 6, 6, 71, 71, 77, 68, 68, 68, 68, 68, 86, 86, 74, 74, 74, 68, 69, 82, 86, 54 },
+	{ 32, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 32, 6, 6, 85, 85, 68, 68, 69 },
+	{ 77, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 82, 68, 68, 68, 69 },
+	{ 32, 32, 32, 32, 32, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 86, 86, 75, 75, 75, 75, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32 },
+	{ 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 43, 43, 43, 43, 43, 43, 43, 43, 86, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 68, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 32, 32, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 50, 50, 50, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 37, 6, 8, 8, 8, 50, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 50, 36 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 36, 36, 6, 6 },
+	{ 37, 37, 37, 37, 37, 37, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 6, 6, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 36, 36, 36, 36, 36, 36, 36, 36, 36 },
+	{ 53, 53, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 36, 34, 34, 34, 34, 34, 34, 34, 34, 33, 34, 33, 34, 33, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 36, 53, 53, 33, 34, 33, 34, 37, 33, 34, 33, 34, 34, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 33, 33, 33, 33, 34, 33, 33, 33, 33, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34 },
+	{ 33, 34, 33, 34, 33, 33, 33, 33, 34, 33, 34, 32, 32, 32, 32, 32, 33, 34, 32, 34, 32, 34, 33, 34, 33, 34, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 36, 36, 36, 33, 34, 37, 36, 36, 34, 37, 37, 37, 37, 37 },
+	{ 37, 37, 6, 37, 37, 37, 6, 37, 37, 37, 37, 6, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 39, 39, 6, 6, 39, 54, 54, 54, 54, 6, 32, 32, 32, 43, 43, 43, 43, 43, 43, 54, 54, 52, 54, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 39, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39 },
+	{ 39, 39, 39, 39, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 50, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 37, 37, 37, 37, 37, 37, 50, 50, 50, 37, 50, 37, 37, 6 },
+	{ 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 50, 50, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 39, 39, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 50 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 39, 39, 6, 6, 6, 6, 39, 39, 6, 6, 39, 39 },
+	{ 39, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32, 36, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 50, 50 },
+	{ 37, 37, 37, 37, 37, 6, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 37, 37, 37, 37, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 39, 39, 6, 6, 39, 39, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 6, 37, 37, 37, 37, 37, 37, 37, 37, 6, 39, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 50, 50, 50, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 54, 54, 54, 37, 39, 6, 39, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 37, 6, 6, 6, 37, 37, 6, 6, 37, 37, 37, 37, 37, 6, 6 },
+	{ 37, 6, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 36, 50, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 6, 6, 39, 39, 50, 50, 37, 36, 36, 39, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 53, 36, 36, 36, 36 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 53, 53, 32, 32, 32, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 37, 37, 37, 39, 39, 6, 39, 39, 6, 39, 39, 50, 39, 6, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 69, 69, 69, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0 },
+	{ 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60 },
+	{ 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 64, 64, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 64, 64, 64, 64, 64, 64 },
+	{ 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64 },
+	{ 34, 34, 34, 34, 34, 34, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 34, 34, 34, 32, 32, 32, 32, 32, 37, 6, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 51, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 32, 37, 32 },
+	{ 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53 },
+	{ 53, 53, 53, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 47, 46 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 52, 54, 54, 54 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 82, 82, 82, 82, 82, 82, 82, 78, 79, 82, 32, 32, 32, 32, 32, 32 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 82, 77, 77, 76, 76, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78 },
+	{ 79, 78, 79, 78, 79, 82, 82, 78, 79, 82, 82, 82, 82, 76, 76, 76, 82, 82, 82, 32, 82, 82, 82, 82, 77, 78, 79, 78, 79, 78, 79, 82 },
+	{ 82, 82, 83, 77, 83, 83, 83, 32, 82, 84, 82, 82, 32, 32, 32, 32, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 27 },
+	{ 32, 82, 82, 82, 84, 82, 82, 82, 78, 79, 82, 83, 82, 77, 82, 82, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 82, 82, 83, 83, 83, 82 },
+	{ 82, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 78, 82, 79, 85, 76 },
+	{ 85, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 78, 83, 79, 83, 78 },
+	{ 79, 50, 46, 47, 50, 50, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 36 },
+	{ 32, 32, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 32, 32, 32 },
+	{ 84, 84, 83, 85, 86, 84, 84, 32, 54, 51, 51, 51, 51, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 27, 27, 27, 54, 54, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32 },
+	{ 50, 50, 50, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 43, 43, 54, 54, 54, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32 },
+	{ 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 6, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 6, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 42, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 50 },
+	{ 37, 37, 37, 37, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 50, 42, 42, 42, 42, 42, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 32, 32, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 50, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 33, 33, 33, 33, 33, 33, 33, 32, 33, 33, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 34, 34, 34, 34, 34, 34, 34, 32, 34, 34, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 36, 36, 36, 36, 36, 36, 32, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36 },
+	{ 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 32, 36, 36, 36, 36, 36, 36, 36, 36, 36, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 32, 32, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 32, 32, 37, 32, 32, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 50, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 54, 54, 43, 43, 43, 43, 43, 43, 43 },
+	{ 32, 32, 32, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 32, 32, 32, 32, 43, 43, 43, 43, 43 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 43, 43, 43, 43, 43, 43, 32, 32, 32, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 43, 43, 37, 37 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 37, 6, 6, 6, 32, 6, 6, 32, 32, 32, 32, 32, 6, 6, 6, 6, 37, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 6, 6, 6, 32, 32, 32, 32, 6 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 43, 43, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 43, 43, 43 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 54, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 6, 6, 32, 32, 32, 32, 43, 43, 43, 43, 43, 50, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 50, 50, 50, 50, 50, 50, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 50, 50, 50, 50, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 32, 32, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43 },
+	{ 37, 37, 37, 37, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 6, 6, 45, 32, 32, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 43, 43, 43, 37, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 43, 43, 43, 43, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 6, 6, 6, 6, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 39, 6, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 50, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 43, 43, 43, 43, 43, 43, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 6, 37, 37, 6, 6, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 6 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 39, 39, 6, 6, 50, 50, 27, 50, 50 },
+	{ 50, 50, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 27, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 6, 6, 6, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 39, 6, 6, 6, 6, 6, 6, 6, 6, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41 },
+	{ 50, 50, 50, 50, 37, 39, 39, 37, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 50, 50, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 6, 39 },
+	{ 39, 37, 37, 37, 37, 50, 50, 50, 50, 6, 6, 6, 6, 50, 39, 6, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 50, 37, 50, 50, 50 },
+	{ 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 39, 39, 6, 39, 6, 6, 50, 50, 50, 50, 50, 50, 6, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 37, 32, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 50, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6 },
+	{ 39, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 6, 6, 39, 39, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 32, 6, 6, 37, 39, 39 },
+	{ 6, 39, 39, 39, 39, 32, 32, 39, 39, 32, 32, 39, 39, 39, 32, 32, 37, 32, 32, 32, 32, 32, 32, 39, 32, 32, 32, 32, 32, 37, 37, 37 },
+	{ 37, 37, 39, 39, 32, 32, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 39, 39, 6, 6, 6, 39, 6, 37, 37, 37, 37, 50, 50, 50, 50, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 50, 32, 50, 6, 37 },
+	{ 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 6, 6, 39, 6, 39, 39, 39, 39, 6 },
+	{ 6, 39, 6, 6, 37, 37, 50, 37, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 32, 32, 39, 39, 39, 39, 6, 6, 39, 6 },
+	{ 6, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 37, 37, 37, 37, 6, 6, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 39, 39, 6, 39, 6 },
+	{ 6, 50, 50, 50, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 39, 6, 39, 39, 6, 6, 6, 6, 6, 6, 39, 6, 37, 50, 32, 32, 32, 32, 32, 32 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 39, 39, 6, 6, 6, 6, 39, 6, 6, 6, 6, 6, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 50, 50, 50, 54 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 6, 6, 6, 6, 6, 39, 6, 6, 50, 32, 32, 32, 32 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 39, 32, 39, 39, 32, 32, 6, 6, 39, 6, 37 },
+	{ 39, 37, 39, 6, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 6, 6, 6, 6, 32, 32, 6, 6, 39, 39, 39, 39 },
+	{ 6, 37, 50, 37, 39, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 39, 37, 6, 6, 6, 6, 50 },
+	{ 50, 50, 50, 50, 50, 50, 50, 6, 32, 32, 32, 32, 32, 32, 32, 32, 37, 6, 6, 6, 6, 6, 6, 39, 39, 6, 6, 6, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 39, 6, 6, 50, 50, 50, 37, 50, 50 },
+	{ 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 6, 6, 6, 6, 6, 6, 6, 32, 6, 6, 6, 6, 6, 6, 39, 6 },
+	{ 37, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 43, 43, 43, 43 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 50, 50, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 32, 39, 6, 6, 6, 6, 6, 6, 6, 39, 6, 6, 39, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 32, 32, 32, 6, 32, 6, 6, 32, 6 },
+	{ 6, 6, 6, 6, 6, 6, 37, 6, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 32, 6, 6, 32, 39, 39, 6, 39, 6, 37, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 39, 39, 50, 50, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 54, 54, 54, 54, 54, 54, 54, 52, 52, 52 },
+	{ 52, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 50 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32 },
+	{ 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 27, 27, 27, 27, 27, 27, 27, 27, 27, 32, 32, 32, 32, 32, 32, 32 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 50, 50, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 6, 6, 6, 6, 6, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 50, 50, 50, 50, 50, 54, 54, 54, 54 },
+	{ 36, 36, 36, 36, 50, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 43, 43, 43, 43, 43 },
+	{ 43, 43, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 37, 37, 37 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 50, 50, 50, 50, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 6, 37, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39 },
+	{ 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39 },
+	{ 39, 39, 39, 39, 39, 39, 39, 39, 32, 32, 32, 32, 32, 32, 32, 6, 6, 6, 6, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36 },
+	{ 68, 68, 82, 68, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 71, 71, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 68, 68, 68, 68, 32, 68, 68, 68, 68, 68, 68, 68, 32, 68, 68, 32 },
+	{ 69, 69, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 69, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 69, 69, 69, 69, 32, 32, 32, 32, 32, 32, 32, 32, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 54, 6, 6, 50 },
+	{ 27, 27, 27, 27, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 39, 39, 6, 6, 6, 54, 54, 54, 39, 39, 39, 39, 39, 39, 27, 27, 27, 27, 27, 27, 27, 27, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 54, 54, 6, 6, 6, 6, 6, 6, 6, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 6, 6, 6, 6, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 6, 6, 6, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 32, 33, 33 },
+	{ 32, 32, 33, 32, 32, 33, 33, 32, 32, 33, 33, 33, 33, 32, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 32, 34, 32, 34, 34, 34 },
+	{ 34, 34, 34, 34, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 33, 33, 32, 33, 33, 33, 33, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 32, 33, 33, 33, 33, 33, 33, 33, 32, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 33, 33, 33, 33, 32 },
+	{ 33, 33, 33, 33, 33, 32, 33, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 34, 34, 34, 34, 34, 34, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 51, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 51, 34, 34, 34, 34 },
+	{ 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 51, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 51, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 51, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 51, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 51, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 51, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33 },
+	{ 33, 33, 33, 33, 33, 33, 33, 33, 33, 51, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 51, 34, 34, 34, 34, 34, 34, 33, 34, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 54, 54, 54, 54, 6, 6, 6, 6, 6 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 54, 54, 54, 54, 54, 54, 54, 54, 6, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 6, 54, 54, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 6, 6, 6, 6, 6 },
+	{ 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 37, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32 },
+	{ 6, 6, 6, 6, 6, 6, 6, 32, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 6, 6, 6, 6, 6 },
+	{ 6, 6, 32, 6, 6, 32, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 6, 6, 6, 6, 6, 6, 6, 36, 36, 36, 36, 36, 36, 36, 32, 32 },
+	{ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 37, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 52 },
+	{ 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32 },
+	{ 37, 37, 37, 37, 37, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34 },
+	{ 34, 34, 34, 34, 6, 6, 6, 6, 6, 6, 6, 36, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 50, 50 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 43, 43, 43, 52, 43, 43, 43, 43, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 32, 32 },
+	{ 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37 },
+	{ 32, 37, 37, 32, 37, 32, 32, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37, 32, 37, 32, 32, 32, 32 },
+	{ 32, 32, 37, 32, 32, 32, 32, 37, 32, 37, 32, 37, 32, 37, 37, 37, 32, 37, 37, 32, 37, 32, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37 },
+	{ 32, 37, 37, 32, 37, 32, 32, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37, 32 },
+	{ 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32 },
+	{ 32, 37, 37, 37, 32, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 51, 51, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 32, 32, 32, 32, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 54, 54, 86, 86, 86, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 54, 86, 54, 54, 54, 86, 86, 86, 85, 85, 85, 85, 85 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54 },
+	{ 86, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 86, 86, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 86, 86, 86, 86, 86, 86, 54, 54, 54, 54, 54, 54, 86, 54, 54, 54, 86, 86, 86, 54, 54, 86, 86, 86, 32, 32, 32, 32, 32, 86, 86, 86 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 32, 32, 32, 54, 54, 54, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 54, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 54, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 54, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 32, 86, 86, 86, 86, 86, 32, 32, 32, 86, 86, 86, 86, 86, 32, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32 },
+	{ 86, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 86, 86, 86, 86, 86, 86, 86, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54 },
+	{ 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 32, 32, 32, 32, 32 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 64, 64, 64, 64, 64, 64, 64 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 64, 64 },
+	{ 69, 69, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69 },
+	{ 69, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64 },
+	{ 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32 },
+	{ 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64 },
+	{ 32, 27, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27 },
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 },
+	{ 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 32, 32 },
+};
+
+// end of the generated tables
+
+// UTF_CATEGORY | width << 5
+static inline uint8_t cp_props(char32_t cp) {
+	if(cp > 0x10FFFF) cp = 0xFFFD;
+	return prop_leaf[prop_mid[prop_top[cp >> 10]][cp >> 5 & 31]][cp & 31];
+}
+
+} // namespace utf_detail
+
+UTF_API int utf_cp_width(char32_t cp) {
+	return utf_detail::cp_props(cp) >> 5;
+}
+
+UTF_API UTF_CATEGORY utf_cp_category(char32_t cp) {
+	return static_cast<UTF_CATEGORY>(utf_detail::cp_props(cp) & 31);
+}
+
+UTF_API size_t utf8_display_width(const void *src, size_t len) {
+	using namespace utf_detail;
+	const uint8_t *s = static_cast<const uint8_t *>(src);
+	const utf_kernels *k = kernels();
+	size_t width = 0;
+	char32_t cps[256];
+	for(size_t i = 0; i < len;) {
+		i += k->ascii_width(s + i, len - i, &width);
+		if(i == len) break;
+		// from the first other codepoint 256 of them are decoded at once, ASCII among them too
+		UTF_Bulk b = k->utf8_decode_columns(s + i, len - i, cps, nullptr, nullptr, 256);
+		for(size_t n = 0; n < b.num_written; n++) width += cp_props(cps[n]) >> 5;
+		i += b.num_read;
+	}
+	return width;
 }
 
 #endif // UTF_IMPLEMENTATION
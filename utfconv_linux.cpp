@@ -0,0 +1,97 @@
+/*
+
+	transcodes a file (or stdin) into a file (or stdout), the input is mapped, never read into a buffer
+	whole, and a file output is sized exactly before it's written
+
+	g++ -std=c++14 -O2 -pthread utfconv_linux.cpp -o utfconv
+	./utfconv [-f utf8|utf16le|utf16be|utf32le|utf32be] [-t ...] [src|-] [dst|-]
+
+	both encodings are utf8 if not given, which only validates; exits with 1 at invalid input (what was
+	before it is written) and 2 when a file can't be read or written
+
+*/
+
+#define UTF_IMPLEMENTATION
+#include "utf.hpp"
+
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+struct Encoding {
+	const char *name;
+	UTF_TYPE type;
+	UTF_BOM bom;
+};
+
+static const Encoding encodings[] = {
+	{ "utf8", UTF8, UTF_LE },
+	{ "utf16le", UTF16, UTF_LE },
+	{ "utf16be", UTF16, UTF_BE },
+	{ "utf32le", UTF32, UTF_LE },
+	{ "utf32be", UTF32, UTF_BE },
+};
+
+const Encoding *find_encoding(const char *name) {
+	for(auto &e : encodings)
+		if(!strcmp(name, e.name)) return &e;
+	return nullptr;
+}
+
+const char *result_name(UTF_RESULT r) {
+	switch(r) {
+		case UTF_UNEXPECTED_CONTINUATION: return "unexpected continuation";
+		case UTF_TOO_FEW_WORDS: return "sequence cut off";
+		case UTF_OVERLONG: return "overlong sequence";
+		case UTF_ILLEGAL_CODEPOINT: return "illegal codepoint";
+		default: return "error";
+	}
+}
+
+int usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [-f utf8|utf16le|utf16be|utf32le|utf32be] [-t ...] [src|-] [dst|-]\n", argv0);
+	return 2;
+}
+
+int main(int argc, char **argv) {
+	const Encoding *from = &encodings[0], *to = &encodings[0];
+	const char *paths[2] = { "-", "-" };
+	int npaths = 0;
+	for(int i = 1; i < argc; i++) {
+		if((!strcmp(argv[i], "-f") || !strcmp(argv[i], "-t")) && i + 1 < argc) {
+			const Encoding *e = find_encoding(argv[i + 1]);
+			if(!e) return usage(argv[0]);
+			(argv[i][1] == 'f' ? from : to) = e;
+			i++;
+		}
+		else if(npaths < 2 && (argv[i][0] != '-' || !argv[i][1])) paths[npaths++] = argv[i];
+		else return usage(argv[0]);
+	}
+
+	int in = strcmp(paths[0], "-") ? open(paths[0], O_RDONLY | O_CLOEXEC) : STDIN_FILENO;
+	if(in < 0) {
+		fprintf(stderr, "%s: %s\n", paths[0], strerror(errno));
+		return 2;
+	}
+	// read and write so it can be mapped
+	int out = strcmp(paths[1], "-") ? open(paths[1], O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666) : STDOUT_FILENO;
+	if(out < 0) {
+		fprintf(stderr, "%s: %s\n", paths[1], strerror(errno));
+		return 2;
+	}
+
+	UTF_FileBulk r = utf_transcode_fd(in, from->type, from->bom, out, to->type, to->bom);
+	if(out != STDOUT_FILENO && close(out) && !r.error) r.error = errno;
+	if(r.error) {
+		fprintf(stderr, "%s -> %s: %s\n", paths[0], paths[1], strerror(r.error));
+		return 2;
+	}
+	if(r.result != UTF_OK) {
+		fprintf(stderr, "%s: invalid %s, %s at byte %llu\n", paths[0], from->name, result_name(r.result),
+			static_cast<unsigned long long>(r.num_read * utf::word_size(from->type)));
+		return 1;
+	}
+	return 0;
+}